@@ -115,3 +115,26 @@ const uint8_t FONTS[][5] PROGMEM = {
   { 0x10, 0x08, 0x08, 0x10, 0x08 }, // 7e ~
   { 0x00, 0x00, 0x00, 0x00, 0x00 }  // 7f
 };
+
+/** @array Large digits 8x14 */
+const uint8_t DIGITS[][14] PROGMEM = {
+  { 0x7e, 0xff, 0xc3, 0xc7, 0xcf, 0xdb, 0xf3, 0xe3, 0xc3, 0xc3, 0xc3, 0xc3, 0xff, 0x7e }, // 0
+  { 0x18, 0x38, 0x78, 0xd8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0xff }, // 1
+  { 0x7e, 0xff, 0xc3, 0x03, 0x03, 0x07, 0x0e, 0x1c, 0x38, 0x70, 0xe0, 0xc0, 0xff, 0xff }, // 2
+  { 0x7e, 0xff, 0xc3, 0x03, 0x03, 0x1e, 0x1e, 0x03, 0x03, 0x03, 0x03, 0xc3, 0xff, 0x7e }, // 3
+  { 0x06, 0x0e, 0x1e, 0x36, 0x66, 0xc6, 0xc6, 0xff, 0xff, 0x06, 0x06, 0x06, 0x06, 0x06 }, // 4
+  { 0xff, 0xff, 0xc0, 0xc0, 0xc0, 0xfe, 0xff, 0x03, 0x03, 0x03, 0x03, 0xc3, 0xff, 0x7e }, // 5
+  { 0x7e, 0xff, 0xc3, 0xc0, 0xc0, 0xfe, 0xff, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xff, 0x7e }, // 6
+  { 0xff, 0xff, 0x03, 0x03, 0x06, 0x06, 0x0c, 0x0c, 0x18, 0x18, 0x30, 0x30, 0x30, 0x30 }, // 7
+  { 0x7e, 0xff, 0xc3, 0xc3, 0xc3, 0x7e, 0x7e, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xff, 0x7e }, // 8
+  { 0x7e, 0xff, 0xc3, 0xc3, 0xc3, 0xc3, 0xff, 0x7f, 0x03, 0x03, 0x03, 0xc3, 0xff, 0x7e }, // 9
+  { 0x3c, 0x7e, 0xe7, 0xc3, 0xc3, 0xc3, 0xff, 0xff, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3 }, // A
+  { 0xfe, 0xff, 0xc3, 0xc3, 0xc3, 0xfe, 0xfe, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xff, 0xfe }, // B
+  { 0x7e, 0xff, 0xc3, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc3, 0xff, 0x7e }, // C
+  { 0xfc, 0xfe, 0xc7, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc7, 0xfe, 0xfc }, // D
+  { 0xff, 0xff, 0xc0, 0xc0, 0xc0, 0xfc, 0xfc, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xff, 0xff }, // E
+  { 0xff, 0xff, 0xc0, 0xc0, 0xc0, 0xfc, 0xfc, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0 }, // F
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // -
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18 }, // .
+  { 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00 }  // :
+};
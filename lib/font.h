@@ -13,7 +13,7 @@
  * @depend      
  * ---------------------------------------------------------------+
  */
-#include <avr/pgmspace.h>
+#include "st7735_port.h"
 
 #ifndef __FONT_H__
 #define __FONT_H__
@@ -25,4 +25,13 @@
   // @const Characters
   extern const uint8_t FONTS[][CHARS_COLS_LENGTH];
 
+  // Large digits definition
+  // -----------------------------------
+  // number of columns for digits
+  #define DIGITS_COLS_LENGTH 8
+  // number of rows for digits
+  #define DIGITS_ROWS_LENGTH 14
+  // @const Digits 0-9, A-F, '-', '.', ':' - byte per row, MSB left
+  extern const uint8_t DIGITS[][DIGITS_ROWS_LENGTH];
+
 #endif
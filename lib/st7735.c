@@ -12,7 +12,7 @@
  * @version     2.0
  * @tested      AVR Atmega328
  *
- * @depend      font.h
+ * @depend      font.h, st7735_bus.h
  * --------------------------------------------------------------------------------------------+
  * @descr       Version 1.0 -> applicable for 1 display
  *              Version 2.0 -> applicable for more than 1 display
@@ -22,11 +22,11 @@
  *              http://w8bh.net/avr/AvrTFT.pdf
  */
 
-#include <avr/io.h>
-#include <avr/pgmspace.h>
-#include <util/delay.h>
+#include "st7735_port.h"
 #include "font.h"
 #include "st7735.h"
+#include "st7735_fb.h"
+#include "st7735_stats.h"
 
 /** @array Init command */
 const uint8_t INIT_ST7735B[] PROGMEM = {
@@ -86,91 +86,250 @@ unsigned short int cacheMemIndexRow = 0;
 unsigned short int cacheMemIndexCol = 0;
 
 /**
- * @desc    Hardware Reset
+ * @desc    Hardware Reset through bus
  *
- * @param   struct signal *
+ * @param   struct st7735 *
  *
  * @return  void
  */
-void ST7735_Reset (struct signal * reset)
+void ST7735_HardReset (struct st7735 * lcd)
 {
-  // Actiavte pull-up resistor logical high on pin RST
-  // posible write: SET_BIT (*(*reset).port, reset->pin)
-  SET_BIT (*(reset->port), reset->pin);
-  // DDR as output
-  SET_BIT (*(reset->ddr), reset->pin);
+  // Reset High
+  lcd->bus->reset (lcd, 1);
   // delay 200 ms
-  _delay_ms(200);
-  // Reset Low 
-  CLR_BIT (*(reset->port), reset->pin);
+  ST7735_DelayMs (200);
+  // Reset Low
+  lcd->bus->reset (lcd, 0);
   // delay 200 ms
-  _delay_ms(200);
+  ST7735_DelayMs (200);
   // Reset High
-  SET_BIT (*(reset->port), reset->pin);
+  lcd->bus->reset (lcd, 1);
 }
 
 /**
- * @desc    Init SPI
+ * @desc    Init st7735 driver
  *
- * @param   void
+ * @param   struct st7735 *
  *
  * @return  void
  */
-void ST7735_SPI_Init (void)
+void ST7735_Init (struct st7735 * lcd)
 {
-  // Output: SCK, MOSI 
-  SET_BIT (DDR, ST7735_SCK);
-  SET_BIT (DDR, ST7735_MOSI);
-/*
-  // Input: MISO with pullup
-  CLR_BIT (DDR, ST7735_MOSI);
-  PORT_BIT (PORT, ST7735_MOSI);
-*/
-  // SPE  - SPI Enale
-  // MSTR - Master device
-  SET_BIT (SPCR, SPE);
-  SET_BIT (SPCR, MSTR);
-  // SPI2X - Prescaler fclk/2 = 8MHz
-  SET_BIT (SPSR, SPI2X);
+  // time in ms
+  uint16_t now = 0;
+
+  // start init
+  ST7735_InitStart (lcd, now);
+  // step till ready
+  while (ST7735_InitTick (lcd, now) == ST7735_BUSY) {
+    // 1 ms delay
+    ST7735_DelayMs (1);
+    // update time
+    now++;
+  }
 }
 
 /**
- * @desc    Init Pins
+ * @desc    Init group of displays together
+ *          reset lines are pulsed at once and command tables interleaved,
+ *          so delays of all displays overlap and startup does not grow
+ *          with number of displays
+ *
+ * @param   struct st7735 ** lcds
+ * @param   uint8_t count
+ *
+ * @return  void
+ */
+void ST7735_InitGroup (struct st7735 ** lcds, uint8_t count)
+{
+  // time in ms
+  uint16_t now = 0;
+  uint8_t busy;
+  uint8_t i;
+
+  // start all - reset lines high together
+  for (i = 0; i < count; i++) {
+    ST7735_InitStart (lcds[i], now);
+  }
+  // step all till ready
+  do {
+    busy = 0;
+    // loop through displays
+    for (i = 0; i < count; i++) {
+      // each display waits for its own deadline
+      if (ST7735_InitTick (lcds[i], now) == ST7735_BUSY) {
+        busy = 1;
+      }
+    }
+    // some display not ready
+    if (busy) {
+      // 1 ms delay
+      ST7735_DelayMs (1);
+      // update time
+      now++;
+    }
+  } while (busy);
+}
+
+/**
+ * @desc    Start non-blocking init
  *
  * @param   struct st7735 *
+ * @param   uint16_t now - time in ms, e.g. from system timer
  *
  * @return  void
  */
-void ST7735_Pins_Init (struct st7735 * lcd)
+void ST7735_InitStart (struct st7735 * lcd, uint16_t now)
 {
-  // DDR
-  // --------------------------------------
-  SET_BIT (*(lcd->cs->ddr), lcd->cs->pin);
-  SET_BIT (*(lcd->bl->ddr), lcd->bl->pin);
-  SET_BIT (*(lcd->dc->ddr), lcd->dc->pin);
-  // PORT
-  // --------------------------------------
-  SET_BIT (*(lcd->cs->port), lcd->cs->pin);   // Chip Select H
-  SET_BIT (*(lcd->bl->port), lcd->bl->pin);   // BackLigt ON
+#if defined(__AVR__)
+  // default bus - hardware SPI
+  if (lcd->bus == NULL) {
+    lcd->bus = &ST7735_BUS_SPI;
+  }
+#endif
+  // init bus and pins
+  lcd->bus->init (lcd);
+  // landscape as set by INIT_ST7735B
+  lcd->width = MAX_X;
+  lcd->height = MAX_Y;
+  lcd->madctl = MADCTL_MY | MADCTL_MV | MADCTL_RGB;
+  // Reset High
+  lcd->bus->reset (lcd, 1);
+  // wait 200 ms
+  lcd->boot.deadline = now + 200;
+  lcd->boot.state = ST7735_STATE_RESET_HIGH;
 }
 
 /**
- * @desc    Init st7735 driver
+ * @desc    Step non-blocking init, never waits
+ *
+ * @param   struct st7735 *
+ * @param   uint16_t now - time in ms, e.g. from system timer
+ *
+ * @return  uint8_t - ST7735_BUSY / ST7735_SUCCESS when ready
+ */
+uint8_t ST7735_InitTick (struct st7735 * lcd, uint16_t now)
+{
+  uint8_t args;
+  uint8_t cmnd;
+  uint8_t time;
+
+  // ready
+  if (lcd->boot.state == ST7735_STATE_READY) {
+    return ST7735_SUCCESS;
+  }
+  // current step not finished
+  if ((int16_t) (now - lcd->boot.deadline) < 0) {
+    return ST7735_BUSY;
+  }
+
+  switch (lcd->boot.state) {
+    // reset high done
+    case ST7735_STATE_RESET_HIGH:
+      // Reset Low
+      lcd->bus->reset (lcd, 0);
+      // wait 200 ms
+      lcd->boot.deadline = now + 200;
+      lcd->boot.state = ST7735_STATE_RESET_LOW;
+      break;
+
+    // reset low done
+    case ST7735_STATE_RESET_LOW:
+      // Reset High
+      lcd->bus->reset (lcd, 1);
+      // list of commands
+      lcd->boot.command = INIT_ST7735B;
+      lcd->boot.remaining = pgm_read_byte (lcd->boot.command++);
+      lcd->boot.state = ST7735_STATE_COMMANDS;
+      break;
+
+    // previous command delay done
+    case ST7735_STATE_COMMANDS:
+      // whole list sent
+      if (lcd->boot.remaining == 0) {
+        // clip to whole screen
+        ST7735_ResetClip (lcd);
+        lcd->boot.state = ST7735_STATE_READY;
+        // ready
+        return ST7735_SUCCESS;
+      }
+      // 1st arg - number of command arguments
+      args = pgm_read_byte (lcd->boot.command++);
+      // 2nd arg - delay time
+      time = pgm_read_byte (lcd->boot.command++);
+      // 3th arg - command
+      cmnd = pgm_read_byte (lcd->boot.command++);
+      // send command
+      ST7735_CommandSend (lcd, cmnd);
+      // send arguments
+      while (args--) {
+        // send argument
+        ST7735_Data8BitsSend (lcd, pgm_read_byte (lcd->boot.command++));
+      }
+      // wait
+      lcd->boot.deadline = now + time;
+      lcd->boot.remaining--;
+      break;
+
+    // not started
+    default:
+      return ST7735_ERROR;
+  }
+  // next step
+  return ST7735_BUSY;
+}
+
+/**
+ * @desc    Set rotation and mirroring
+ *          clip is reset to whole screen, content of framebuffer is kept
+ *          as is and sent whole with next flush - redraw it before
  *
  * @param   struct st7735 *
+ * @param   uint8_t rotation - ROTATE_0 / 90 / 180 / 270 | MIRROR_X | MIRROR_Y
  *
  * @return  void
  */
-void ST7735_Init (struct st7735 * lcd)
+void ST7735_SetRotation (struct st7735 * lcd, uint8_t rotation)
 {
-  // init pins
-  ST7735_Pins_Init (lcd);
-  // init SPI
-  ST7735_SPI_Init ();
-  // hardware reset
-  ST7735_Reset (lcd->rs);
-  // load list of commands
-  ST7735_Commands (lcd, INIT_ST7735B);
+  /** @array MADCTL of rotations, 90 degrees clockwise each */
+  static const uint8_t MADCTL_ROTATION[4] PROGMEM = {
+    MADCTL_MY | MADCTL_MV,
+    0,
+    MADCTL_MX | MADCTL_MV,
+    MADCTL_MX | MADCTL_MY
+  };
+  uint8_t madctl = pgm_read_byte (&MADCTL_ROTATION[rotation & 0x03]);
+
+  // mirror x - columns are rows if exchanged
+  if (rotation & MIRROR_X) {
+    madctl ^= (madctl & MADCTL_MV) ? MADCTL_MY : MADCTL_MX;
+  }
+  // mirror y
+  if (rotation & MIRROR_Y) {
+    madctl ^= (madctl & MADCTL_MV) ? MADCTL_MX : MADCTL_MY;
+  }
+  // landscape
+  if (madctl & MADCTL_MV) {
+    lcd->width = MAX_X;
+    lcd->height = MAX_Y;
+  // portrait
+  } else {
+    lcd->width = MAX_Y;
+    lcd->height = MAX_X;
+  }
+  lcd->madctl = madctl | MADCTL_RGB;
+  // memory data access control
+  ST7735_CommandSend (lcd, MADCTL);
+  // send argument
+  ST7735_Data8BitsSend (lcd, lcd->madctl);
+  // clip to whole screen
+  ST7735_ResetClip (lcd);
+#if defined(ST7735_FRAMEBUFFER)
+  // panel content no longer matches shadow
+  if (lcd->fb != NULL) {
+    lcd->fb->valid = 0;
+  }
+#endif
 }
 
 /**
@@ -216,22 +375,51 @@ void ST7735_Commands (struct st7735 * lcd, const uint8_t * initializers)
  * @param   struct st7735 *
  * @param   uint8_t
  *
- * @return void
+ * @return  uint8_t
  */
 uint8_t ST7735_CommandSend (struct st7735 * lcd, uint8_t data)
 {
+  ST7735_STATS_ENTER (ST7735_STAT_COMMAND);
+  ST7735_STATS_ADD (command_bytes, 1);
+  ST7735_STATS_ADD (cs_toggles, 1);
   // chip enable - active low
-  CLR_BIT (*(lcd->cs->port), lcd->cs->pin);
+  lcd->bus->select (lcd, 1);
   // command (active low)
-  CLR_BIT (*(lcd->dc->port), lcd->dc->pin);
+  lcd->bus->mode (lcd, ST7735_COMMAND);
   // transmitting data
-  SPDR = data;
-  // wait till data transmit
-  WAIT_UNTIL_BIT_IS_SET (SPSR, SPIF);
+  lcd->bus->write (lcd, &data, 1);
   // chip disable - idle high
-  SET_BIT (*(lcd->cs->port), lcd->cs->pin);
-  // return received data
-  return SPDR;
+  lcd->bus->select (lcd, 0);
+  ST7735_STATS_LEAVE (ST7735_STAT_COMMAND);
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Bulk data send
+ *
+ * @param   struct st7735 *
+ * @param   const uint8_t * buffer
+ * @param   uint16_t length
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7735_DataSend (struct st7735 * lcd, const uint8_t * buffer, uint16_t length)
+{
+  ST7735_STATS_ENTER (ST7735_STAT_DATA);
+  ST7735_STATS_ADD (data_bytes, length);
+  ST7735_STATS_ADD (cs_toggles, 1);
+  // chip enable - active low
+  lcd->bus->select (lcd, 1);
+  // data (active high)
+  lcd->bus->mode (lcd, ST7735_DATA);
+  // transmitting whole buffer
+  lcd->bus->write (lcd, buffer, length);
+  // chip disable - idle high
+  lcd->bus->select (lcd, 0);
+  ST7735_STATS_LEAVE (ST7735_STAT_DATA);
+  // success
+  return ST7735_SUCCESS;
 }
 
 /**
@@ -240,22 +428,16 @@ uint8_t ST7735_CommandSend (struct st7735 * lcd, uint8_t data)
  * @param   struct st7735 *
  * @param   uint8_t
  *
- * @return  void
+ * @return  uint8_t
  */
 uint8_t ST7735_Data8BitsSend (struct st7735 * lcd, uint8_t data)
 {
-  // chip enable - active low
-  CLR_BIT (*(lcd->cs->port), lcd->cs->pin);
-  // data (active high)
-  SET_BIT (*(lcd->dc->port), lcd->dc->pin);
+  ST7735_STATS_ENTER (ST7735_STAT_DATA8);
   // transmitting data
-  SPDR = data;
-  // wait till data transmit
-  WAIT_UNTIL_BIT_IS_SET (SPSR, SPIF);
-  // chip disable - idle high
-  SET_BIT (*(lcd->cs->port), lcd->cs->pin);
-  // return received data
-  return SPDR;
+  ST7735_DataSend (lcd, &data, 1);
+  ST7735_STATS_LEAVE (ST7735_STAT_DATA8);
+  // success
+  return ST7735_SUCCESS;
 }
 
 /**
@@ -264,26 +446,19 @@ uint8_t ST7735_Data8BitsSend (struct st7735 * lcd, uint8_t data)
  * @param   struct st7735 * lcd
  * @param   uint16_t
  *
- * @return  void
+ * @return  uint8_t
  */
 uint8_t ST7735_Data16BitsSend (struct st7735 * lcd, uint16_t data)
 {
-  // chip enable - active low
-  CLR_BIT (*(lcd->cs->port), lcd->cs->pin);
-  // data (active high)
-  SET_BIT (*(lcd->dc->port), lcd->dc->pin);
-  // transmitting data high byte
-  SPDR = (uint8_t) (data >> 8);
-  // wait till high byte transmit
-  WAIT_UNTIL_BIT_IS_SET (SPSR, SPIF);
-  // transmitting data low byte
-  SPDR = (uint8_t) (data);
-  // wait till low byte transmit
-  WAIT_UNTIL_BIT_IS_SET (SPSR, SPIF);
-  // chip disable - idle high
-  SET_BIT (*(lcd->cs->port), lcd->cs->pin);
-  // return received data
-  return SPDR;
+  // high byte first
+  uint8_t buffer[2] = { (uint8_t) (data >> 8), (uint8_t) (data) };
+
+  ST7735_STATS_ENTER (ST7735_STAT_DATA16);
+  // transmitting data
+  ST7735_DataSend (lcd, buffer, 2);
+  ST7735_STATS_LEAVE (ST7735_STAT_DATA16);
+  // success
+  return ST7735_SUCCESS;
 }
 
 /**
@@ -299,32 +474,161 @@ uint8_t ST7735_Data16BitsSend (struct st7735 * lcd, uint16_t data)
  */
 uint8_t ST7735_SetWindow (struct st7735 * lcd, uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1)
 {
+  ST7735_STATS_ENTER (ST7735_STAT_WINDOW);
   // check if coordinates is out of range
-  if ((x0 > x1)     ||
-      (x1 > SIZE_X) ||
-      (y0 > y1)     ||
-      (y1 > SIZE_Y)) { 
+  if ((x0 > x1)             ||
+      (x1 >= lcd->width)    ||
+      (y0 > y1)             ||
+      (y1 >= lcd->height)) {
+    ST7735_STATS_LEAVE (ST7735_STAT_WINDOW);
     // out of range
     return ST7735_ERROR;
   }  
+#if defined(ST7735_FRAMEBUFFER)
+  // render into memory
+  if (lcd->fb != NULL) {
+    // window of framebuffer
+    ST7735_FB_Window (lcd, x0, x1, y0, y1);
+    ST7735_STATS_LEAVE (ST7735_STAT_WINDOW);
+    // success
+    return ST7735_SUCCESS;
+  }
+#endif
+  // start / end x position
+  uint8_t columns[4] = { 0x00, x0, 0x00, x1 };
+  // start / end y position
+  uint8_t rows[4] = { 0x00, y0, 0x00, y1 };
+
   // column address set
   ST7735_CommandSend (lcd, CASET);
-  // send start x position
-  ST7735_Data16BitsSend (lcd, 0x0000 | x0);
-  // send end x position
-  ST7735_Data16BitsSend (lcd, 0x0000 | x1);
+  // send start, end x position
+  ST7735_DataSend (lcd, columns, 4);
 
   // row address set
   ST7735_CommandSend (lcd, RASET);
-  // send start y position
-  ST7735_Data16BitsSend (lcd, 0x0000 | y0);
-  // send end y position
-  ST7735_Data16BitsSend (lcd, 0x0000 | y1);
+  // send start, end y position
+  ST7735_DataSend (lcd, rows, 4);
+
+  ST7735_STATS_LEAVE (ST7735_STAT_WINDOW);
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Set clip rectangle
+ *
+ * @param   struct st7735 * lcd
+ * @param   uint8_t x - start position
+ * @param   uint8_t x - end position
+ * @param   uint8_t y - start position
+ * @param   uint8_t y - end position
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7735_SetClip (struct st7735 * lcd, uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1)
+{
+  // check if clip is empty or out of screen
+  if ((x0 > x1)             ||
+      (x0 >= lcd->width)    ||
+      (y0 > y1)             ||
+      (y0 >= lcd->height)) {
+    // out of range
+    return ST7735_ERROR;
+  }
+  // limit to screen
+  lcd->clip.x0 = x0;
+  lcd->clip.x1 = (x1 >= lcd->width) ? lcd->width - 1 : x1;
+  lcd->clip.y0 = y0;
+  lcd->clip.y1 = (y1 >= lcd->height) ? lcd->height - 1 : y1;
 
   // success
   return ST7735_SUCCESS;
 }
 
+/**
+ * @desc    Reset clip rectangle to whole screen
+ *
+ * @param   struct st7735 * lcd
+ *
+ * @return  void
+ */
+void ST7735_ResetClip (struct st7735 * lcd)
+{
+  lcd->clip.x0 = 0;
+  lcd->clip.x1 = lcd->width - 1;
+  lcd->clip.y0 = 0;
+  lcd->clip.y1 = lcd->height - 1;
+}
+
+/**
+ * @desc    Clip window to clip rectangle
+ *
+ * @param   struct st7735 * lcd
+ * @param   struct window * window - ordered coordinates, updated in place
+ *
+ * @return  uint8_t - ST7735_ERROR if nothing is visible
+ */
+uint8_t ST7735_ClipWindow (struct st7735 * lcd, struct window * win)
+{
+  // check if window is outside of clip rectangle
+  if ((win->x1 < lcd->clip.x0) ||
+      (win->x0 > lcd->clip.x1) ||
+      (win->y1 < lcd->clip.y0) ||
+      (win->y0 > lcd->clip.y1)) {
+    // nothing visible
+    return ST7735_ERROR;
+  }
+  // intersect x span
+  if (win->x0 < lcd->clip.x0) { win->x0 = lcd->clip.x0; }
+  if (win->x1 > lcd->clip.x1) { win->x1 = lcd->clip.x1; }
+  // intersect y span
+  if (win->y0 < lcd->clip.y0) { win->y0 = lcd->clip.y0; }
+  if (win->y1 > lcd->clip.y1) { win->y1 = lcd->clip.y1; }
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Fill clipped window with color
+ *
+ * @param   struct st7735 * lcd
+ * @param   uint8_t x - start position
+ * @param   uint8_t x - end position
+ * @param   uint8_t y - start position
+ * @param   uint8_t y - end position
+ * @param   uint16_t color
+ *
+ * @return  void
+ */
+void ST7735_FillWindow (struct st7735 * lcd, uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1, uint16_t color)
+{
+  struct window win = { .x0 = x0, .x1 = x1, .y0 = y0, .y1 = y1 };
+
+  ST7735_STATS_ENTER (ST7735_STAT_FILL);
+  // cull before any command is sent
+  if (ST7735_ClipWindow (lcd, &win) == ST7735_ERROR) {
+    ST7735_STATS_LEAVE (ST7735_STAT_FILL);
+    // nothing visible
+    return;
+  }
+#if defined(ST7735_FRAMEBUFFER)
+  // render into memory
+  if (lcd->fb != NULL) {
+    // fill rectangle of framebuffer
+    ST7735_FB_Rectangle (lcd, &win, color);
+    ST7735_STATS_LEAVE (ST7735_STAT_FILL);
+    // done
+    return;
+  }
+#endif
+  // set window
+  ST7735_SetWindow (lcd, win.x0, win.x1, win.y0, win.y1);
+  // send color
+  ST7735_SendColor565 (lcd, color, (uint16_t) (win.x1 - win.x0 + 1) * (win.y1 - win.y0 + 1));
+  ST7735_STATS_LEAVE (ST7735_STAT_FILL);
+}
+
 /**
  * @desc    Write color pixels
  *
@@ -336,31 +640,721 @@ uint8_t ST7735_SetWindow (struct st7735 * lcd, uint8_t x0, uint8_t x1, uint8_t y
  */
 void ST7735_SendColor565 (struct st7735 * lcd, uint16_t color, uint16_t count)
 {
+  // high byte first
+  uint8_t buffer[ST7735_FILL_CHUNK];
+  uint8_t length;
+  uint8_t i;
+
+  ST7735_STATS_ENTER (ST7735_STAT_COLOR);
+#if defined(ST7735_FRAMEBUFFER)
+  // render into memory
+  if (lcd->fb != NULL) {
+    // pixels into window of framebuffer
+    ST7735_FB_Fill (lcd, color, count);
+    ST7735_STATS_LEAVE (ST7735_STAT_COLOR);
+    // done
+    return;
+  }
+#endif
   // access to RAM
   ST7735_CommandSend (lcd, RAMWR);
+  ST7735_STATS_ADD (data_bytes, (uint32_t) count << 1);
+  ST7735_STATS_ADD (cs_toggles, 1);
+  // chip enable - active low
+  lcd->bus->select (lcd, 1);
+  // data (active high)
+  lcd->bus->mode (lcd, ST7735_DATA);
+  // backend repeats color itself
+  if (lcd->bus->fill != NULL) {
+    // whole burst at once
+    lcd->bus->fill (lcd, color, count);
+  } else {
+    // fill chunk with color
+    for (i = 0; i < ST7735_FILL_CHUNK; i += 2) {
+      buffer[i] = (uint8_t) (color >> 8);
+      buffer[i + 1] = (uint8_t) (color);
+    }
+    // send chunks
+    while (count) {
+      // pixels in this chunk
+      length = (count > (ST7735_FILL_CHUNK >> 1)) ? (ST7735_FILL_CHUNK >> 1) : count;
+      // write color
+      lcd->bus->write (lcd, buffer, length << 1);
+      // update counter
+      count -= length;
+    }
+  }
+  // chip disable - idle high
+  lcd->bus->select (lcd, 0);
+  ST7735_STATS_LEAVE (ST7735_STAT_COLOR);
+}
+
+/**
+ * @desc    Write array of color pixels into window set before
+ *          backend streams array itself when it can, otherwise pixels are
+ *          swapped to high byte first in chunks and sent by write
+ *
+ * @param   struct st7735 * lcd
+ * @param   const uint16_t * pixels - 565 colors
+ * @param   uint16_t count
+ * @param   uint8_t memory - ST7735_SRAM / ST7735_FLASH
+ *
+ * @return  void
+ */
+void ST7735_WritePixels (struct st7735 * lcd, const uint16_t * pixels, uint16_t count, uint8_t memory)
+{
+  // high byte first
+  uint8_t buffer[ST7735_FILL_CHUNK];
+  uint16_t color;
+  uint8_t length;
+  uint8_t i;
+
+  ST7735_STATS_ENTER (ST7735_STAT_PIXELS);
+#if defined(ST7735_FRAMEBUFFER)
+  // render into memory
+  if (lcd->fb != NULL) {
+    // pixels into window of framebuffer
+    while (count--) {
+      color = (memory == ST7735_FLASH) ? pgm_read_word (pixels) : *pixels;
+      ST7735_FB_Fill (lcd, color, 1);
+      pixels++;
+    }
+    ST7735_STATS_LEAVE (ST7735_STAT_PIXELS);
+    // done
+    return;
+  }
+#endif
+  // access to RAM
+  ST7735_CommandSend (lcd, RAMWR);
+  ST7735_STATS_ADD (data_bytes, (uint32_t) count << 1);
+  ST7735_STATS_ADD (cs_toggles, 1);
+  // chip enable - active low
+  lcd->bus->select (lcd, 1);
+  // data (active high)
+  lcd->bus->mode (lcd, ST7735_DATA);
+  // backend streams array itself
+  if (lcd->bus->pixels != NULL) {
+    // whole array at once
+    lcd->bus->pixels (lcd, pixels, count, memory);
+  } else {
+    // send chunks
+    while (count) {
+      // pixels in this chunk
+      length = (count > (ST7735_FILL_CHUNK >> 1)) ? (ST7735_FILL_CHUNK >> 1) : count;
+      // swap into chunk
+      for (i = 0; i < length; i++) {
+        color = (memory == ST7735_FLASH) ? pgm_read_word (pixels) : *pixels;
+        buffer[(i << 1)] = (uint8_t) (color >> 8);
+        buffer[(i << 1) + 1] = (uint8_t) (color);
+        pixels++;
+      }
+      // write colors
+      lcd->bus->write (lcd, buffer, length << 1);
+      // update counter
+      count -= length;
+    }
+  }
+  // chip disable - idle high
+  lcd->bus->select (lcd, 0);
+  ST7735_STATS_LEAVE (ST7735_STAT_PIXELS);
+}
+
+/**
+ * @desc    Fill wire order buffer with color
+ *
+ * @param   struct st7735_wire * buffer
+ * @param   uint16_t color
+ * @param   uint16_t count
+ *
+ * @return  void
+ */
+void ST7735_Wire_Fill (struct st7735_wire * buffer, uint16_t color, uint16_t count)
+{
+  struct st7735_wire wire = ST7735_WIRE (color);
+
   // counter
   while (count--) {
-    // write color
-    ST7735_Data16BitsSend (lcd, color);
+    *buffer++ = wire;
+  }
+}
+
+/**
+ * @desc    Convert 565 colors to wire order
+ *          swap is done once when buffer is produced, not on every send
+ *
+ * @param   struct st7735_wire * destination
+ * @param   const uint16_t * source - may be same memory as destination
+ * @param   uint16_t count
+ *
+ * @return  void
+ */
+void ST7735_Wire_Convert (struct st7735_wire * buffer, const uint16_t * pixels, uint16_t count)
+{
+  uint16_t color;
+
+  // counter
+  while (count--) {
+    // read before write, in place allowed
+    color = *pixels++;
+    buffer->high = (uint8_t) (color >> 8);
+    buffer->low = (uint8_t) (color);
+    buffer++;
+  }
+}
+
+/**
+ * @desc    Write wire order pixels into window set before
+ *          buffer is handed to bus as bytes, no staging copy and no per pixel work
+ *
+ * @param   struct st7735 * lcd
+ * @param   const struct st7735_wire * pixels - in SRAM
+ * @param   uint16_t count
+ *
+ * @return  void
+ */
+void ST7735_WriteWire (struct st7735 * lcd, const struct st7735_wire * pixels, uint16_t count)
+{
+  ST7735_STATS_ENTER (ST7735_STAT_PIXELS);
+#if defined(ST7735_FRAMEBUFFER)
+  // render into memory
+  if (lcd->fb != NULL) {
+    // pixels into window of framebuffer
+    while (count--) {
+      ST7735_FB_Fill (lcd, ST7735_WIRE_COLOR (*pixels), 1);
+      pixels++;
+    }
+    ST7735_STATS_LEAVE (ST7735_STAT_PIXELS);
+    // done
+    return;
+  }
+#endif
+  // access to RAM
+  ST7735_CommandSend (lcd, RAMWR);
+  ST7735_STATS_ADD (data_bytes, (uint32_t) count << 1);
+  ST7735_STATS_ADD (cs_toggles, 1);
+  // chip enable - active low
+  lcd->bus->select (lcd, 1);
+  // data (active high)
+  lcd->bus->mode (lcd, ST7735_DATA);
+  // already high byte first
+  lcd->bus->write (lcd, (const uint8_t *) pixels, count << 1);
+  // chip disable - idle high
+  lcd->bus->select (lcd, 0);
+  ST7735_STATS_LEAVE (ST7735_STAT_PIXELS);
+}
+
+/**
+ * @desc    Start burst of pixels into window
+ *          pixels pushed row by row are buffered and handed to bus in chunks,
+ *          so any per pixel source costs one window setup only; window is
+ *          intersected with clip rectangle and pixels out of it are dropped
+ *
+ * @param   struct st7735 * lcd
+ * @param   struct st7735_burst *
+ * @param   uint8_t x - start position
+ * @param   uint8_t x - end position
+ * @param   uint8_t y - start position
+ * @param   uint8_t y - end position
+ *
+ * @return  uint8_t - ST7735_ERROR if nothing visible, pushed pixels are dropped
+ */
+uint8_t ST7735_Burst_Begin (struct st7735 * lcd, struct st7735_burst * burst, uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1)
+{
+  struct window win = { .x0 = x0, .x1 = x1, .y0 = y0, .y1 = y1 };
+
+  // empty buffer
+  burst->length = 0;
+  burst->mode = ST7735_BURST_HIDDEN;
+  // invalid or out of clip
+  if ((x0 > x1) || (y0 > y1) || (ST7735_ClipWindow (lcd, &win) == ST7735_ERROR)) {
+    return ST7735_ERROR;
+  }
+  // set window of visible part
+  if (ST7735_SetWindow (lcd, win.x0, win.x1, win.y0, win.y1) == ST7735_ERROR) {
+    return ST7735_ERROR;
+  }
+  // pushed pixels walk whole window
+  burst->mode = ((win.x0 == x0) && (win.x1 == x1) && (win.y0 == y0) && (win.y1 == y1)) ? ST7735_BURST_WHOLE : ST7735_BURST_CLIPPED;
+  burst->visible = win;
+  burst->x = burst->left = x0;
+  burst->right = x1;
+  burst->y = y0;
+#if defined(ST7735_FRAMEBUFFER)
+  // framebuffer follows window itself
+  if (lcd->fb != NULL) {
+    return ST7735_SUCCESS;
+  }
+#endif
+  // access to RAM
+  ST7735_CommandSend (lcd, RAMWR);
+  ST7735_STATS_ADD (cs_toggles, 1);
+  // chip enable - active low
+  lcd->bus->select (lcd, 1);
+  // data (active high)
+  lcd->bus->mode (lcd, ST7735_DATA);
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Add pixel to burst
+ *
+ * @param   struct st7735 * lcd
+ * @param   struct st7735_burst *
+ * @param   uint16_t color
+ *
+ * @return  void
+ */
+void ST7735_Burst_Push (struct st7735 * lcd, struct st7735_burst * burst, uint16_t color)
+{
+  uint8_t x, y;
+
+  // part of window out of clip
+  if (burst->mode != ST7735_BURST_WHOLE) {
+    // nothing visible
+    if (burst->mode == ST7735_BURST_HIDDEN) {
+      return;
+    }
+    x = burst->x;
+    y = burst->y;
+    // next position, row by row
+    if (burst->x == burst->right) {
+      burst->x = burst->left;
+      burst->y++;
+    } else {
+      burst->x++;
+    }
+    // dropped
+    if ((x < burst->visible.x0) || (x > burst->visible.x1) || (y < burst->visible.y0) || (y > burst->visible.y1)) {
+      return;
+    }
+  }
+#if defined(ST7735_FRAMEBUFFER)
+  // render into memory
+  if (lcd->fb != NULL) {
+    ST7735_FB_Fill (lcd, color, 1);
+    return;
+  }
+#endif
+  // high byte first
+  burst->buffer[burst->length++] = (uint8_t) (color >> 8);
+  burst->buffer[burst->length++] = (uint8_t) (color);
+  // buffer full
+  if (burst->length == ST7735_FILL_CHUNK) {
+    ST7735_STATS_ADD (data_bytes, burst->length);
+    lcd->bus->write (lcd, burst->buffer, burst->length);
+    burst->length = 0;
+  }
+}
+
+/**
+ * @desc    Finish burst
+ *
+ * @param   struct st7735 * lcd
+ * @param   struct st7735_burst *
+ *
+ * @return  void
+ */
+void ST7735_Burst_End (struct st7735 * lcd, struct st7735_burst * burst)
+{
+  // nothing selected
+  if (burst->mode == ST7735_BURST_HIDDEN) {
+    return;
+  }
+#if defined(ST7735_FRAMEBUFFER)
+  // nothing on bus
+  if (lcd->fb != NULL) {
+    return;
   }
+#endif
+  // rest of buffer
+  if (burst->length) {
+    ST7735_STATS_ADD (data_bytes, burst->length);
+    lcd->bus->write (lcd, burst->buffer, burst->length);
+  }
+  // chip disable - idle high
+  lcd->bus->select (lcd, 0);
+}
+
+/**
+ * @desc    Backend has data input wired
+ *
+ * @param   struct st7735 *
+ *
+ * @return  uint8_t - 1 = readback possible
+ */
+static uint8_t ST7735_Readable (struct st7735 * lcd)
+{
+  // backend without data in
+  if (lcd->bus->read == NULL) {
+    return 0;
+  }
+  // bit-bang without MISO pin
+  if ((lcd->bus == &ST7735_BUS_BITBANG) && (((struct st7735_bitbang *) lcd->bus_data)->miso == NULL)) {
+    return 0;
+  }
+  return 1;
+}
+
+/**
+ * @desc    Read window of display memory as 565 pixels
+ *          RAMRD answers after one dummy clock with 3 bytes per pixel
+ *          (R, G, B, 6 bits each left aligned) regardless of COLMOD,
+ *          so received stream is shifted by one bit and reduced to 565
+ *
+ * @param   struct st7735 * lcd
+ * @param   uint8_t x - start position
+ * @param   uint8_t x - end position
+ * @param   uint8_t y - start position
+ * @param   uint8_t y - end position
+ * @param   uint16_t * buffer - (x1 - x0 + 1) * (y1 - y0 + 1) pixels, row by row
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7735_ReadWindow (struct st7735 * lcd, uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1, uint16_t * buffer)
+{
+  uint8_t raw[ST7735_READ_CHUNK];
+  uint8_t rgb[3];
+  uint8_t prev;
+  uint8_t length;
+  uint8_t i;
+  uint8_t k = 0;
+  uint16_t count;
+
+#if defined(ST7735_FRAMEBUFFER)
+  uint8_t x;
+  // framebuffer holds what display will show
+  if (lcd->fb != NULL) {
+    // check if coordinates is out of range
+    if ((x0 > x1) || (x1 >= lcd->width) || (y0 > y1) || (y1 >= lcd->height)) {
+      return ST7735_ERROR;
+    }
+    // loop through rows
+    for (; y0 <= y1; y0++) {
+      for (x = x0; x <= x1; x++) {
+        *buffer++ = lcd->fb->frame[y0 * lcd->width + x];
+      }
+    }
+    // success
+    return ST7735_SUCCESS;
+  }
+#endif
+  // backend without data in
+  if (!ST7735_Readable (lcd)) {
+    return ST7735_ERROR;
+  }
+  // set window
+  if (ST7735_SetWindow (lcd, x0, x1, y0, y1) == ST7735_ERROR) {
+    return ST7735_ERROR;
+  }
+  ST7735_STATS_ENTER (ST7735_STAT_READ);
+  // bytes to receive
+  count = (uint16_t) (x1 - x0 + 1) * (y1 - y0 + 1) * 3;
+  ST7735_STATS_ADD (cs_toggles, 1);
+  // chip enable - kept low from command till last byte
+  lcd->bus->select (lcd, ST7735_SELECT_READ);
+  // command (active low)
+  lcd->bus->mode (lcd, ST7735_COMMAND);
+  // read RAM
+  prev = RAMRD;
+  lcd->bus->write (lcd, &prev, 1);
+  // data (active high)
+  lcd->bus->mode (lcd, ST7735_DATA);
+  // dummy clock and 7 bits of first byte
+  lcd->bus->read (lcd, &prev, 1);
+  // receive chunks
+  while (count) {
+    // bytes in this chunk
+    length = (count > ST7735_READ_CHUNK) ? ST7735_READ_CHUNK : count;
+    // read bytes
+    lcd->bus->read (lcd, raw, length);
+    // loop through bytes
+    for (i = 0; i < length; i++) {
+      // drop dummy bit
+      rgb[k++] = (prev << 1) | (raw[i] >> 7);
+      prev = raw[i];
+      // whole pixel
+      if (k == 3) {
+        *buffer++ = ((uint16_t) (rgb[0] & 0xF8) << 8) | ((uint16_t) (rgb[1] & 0xFC) << 3) | (rgb[2] >> 3);
+        k = 0;
+      }
+    }
+    // update counter
+    count -= length;
+  }
+  // chip disable - idle high
+  lcd->bus->select (lcd, 0);
+  ST7735_STATS_LEAVE (ST7735_STAT_READ);
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Read register bytes
+ *
+ * @param   struct st7735 *
+ * @param   uint8_t command
+ * @param   uint8_t * buffer
+ * @param   uint8_t count
+ * @param   uint8_t dummy - 1 = dummy clock before data (24 bits reads)
+ *
+ * @return  void
+ */
+static void ST7735_ReadRegister (struct st7735 * lcd, uint8_t command, uint8_t * buffer, uint8_t count, uint8_t dummy)
+{
+  uint8_t prev;
+  uint8_t raw;
+
+  // chip enable - kept low from command till last byte
+  lcd->bus->select (lcd, ST7735_SELECT_READ);
+  // command (active low)
+  lcd->bus->mode (lcd, ST7735_COMMAND);
+  lcd->bus->write (lcd, &command, 1);
+  // data (active high)
+  lcd->bus->mode (lcd, ST7735_DATA);
+  if (dummy) {
+    // dummy clock and 7 bits of first byte
+    lcd->bus->read (lcd, &prev, 1);
+    while (count--) {
+      lcd->bus->read (lcd, &raw, 1);
+      // drop dummy bit
+      *buffer++ = (prev << 1) | (raw >> 7);
+      prev = raw;
+    }
+  } else {
+    lcd->bus->read (lcd, buffer, count);
+  }
+  // chip disable - idle high
+  lcd->bus->select (lcd, 0);
+}
+
+/**
+ * @desc    Read display identification, RDDID and RDID1-3
+ *
+ * @param   struct st7735 *
+ * @param   uint8_t * ids - 6 bytes
+ *
+ * @return  void
+ */
+static void ST7735_ReadIds (struct st7735 * lcd, uint8_t * ids)
+{
+  // manufacturer, version, driver
+  ST7735_ReadRegister (lcd, RDDID, ids, 3, 1);
+  ST7735_ReadRegister (lcd, RDID1, ids + 3, 1, 0);
+  ST7735_ReadRegister (lcd, RDID2, ids + 4, 1, 0);
+  ST7735_ReadRegister (lcd, RDID3, ids + 5, 1, 0);
+}
+
+/**
+ * @desc    Compare identification with reference at current clock
+ *
+ * @param   struct st7735 *
+ * @param   const uint8_t * reference - 6 bytes
+ *
+ * @return  uint8_t - ST7735_SUCCESS if equal
+ */
+static uint8_t ST7735_CheckIds (struct st7735 * lcd, const uint8_t * reference)
+{
+  uint8_t ids[6];
+  uint8_t i;
+
+  ST7735_ReadIds (lcd, ids);
+  // loop through bytes
+  for (i = 0; i < 6; i++) {
+    if (ids[i] != reference[i]) {
+      return ST7735_ERROR;
+    }
+  }
+  // equal
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Write GRAM pattern and read it back at current clocks
+ *
+ * @param   struct st7735 *
+ * @param   uint8_t trial - pattern seed
+ *
+ * @return  uint8_t - ST7735_SUCCESS if read back right
+ */
+static uint8_t ST7735_CheckGram (struct st7735 * lcd, uint8_t trial)
+{
+  uint16_t pattern[ST7735_CAL_PIXELS];
+  uint16_t lfsr = 0xACE1 ^ ((uint16_t) trial << 8 | trial);
+  uint8_t i;
+
+  // extremes, then pseudo random bits
+  pattern[0] = 0x0000;
+  pattern[1] = 0xFFFF;
+  for (i = 2; i < ST7735_CAL_PIXELS; i++) {
+    lfsr = (lfsr >> 1) ^ ((lfsr & 1) ? 0xB400 : 0);
+    pattern[i] = lfsr;
+  }
+  // write at clock
+  ST7735_SetWindow (lcd, 0, ST7735_CAL_PIXELS - 1, 0, 0);
+  ST7735_WritePixels (lcd, pattern, ST7735_CAL_PIXELS, ST7735_SRAM);
+  // read at read clock, nothing to compare on failure
+  if (ST7735_ReadWindow (lcd, 0, ST7735_CAL_PIXELS - 1, 0, 0, pattern) == ST7735_ERROR) {
+    return ST7735_ERROR;
+  }
+  // regenerate and compare
+  lfsr = 0xACE1 ^ ((uint16_t) trial << 8 | trial);
+  if ((pattern[0] != 0x0000) || (pattern[1] != 0xFFFF)) {
+    return ST7735_ERROR;
+  }
+  for (i = 2; i < ST7735_CAL_PIXELS; i++) {
+    lfsr = (lfsr >> 1) ^ ((lfsr & 1) ? 0xB400 : 0);
+    if (pattern[i] != lfsr) {
+      return ST7735_ERROR;
+    }
+  }
+  // read back right
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Calibration steps, display memory accessed directly
+ *
+ * @param   struct st7735 *
+ *
+ * @return  uint8_t
+ */
+static uint8_t ST7735_CalibrateSteps (struct st7735 * lcd)
+{
+  uint16_t under[ST7735_CAL_PIXELS];
+  uint8_t reference[6];
+  uint8_t ones = 0xFF;
+  uint8_t zeros = 0x00;
+  uint8_t trial;
+  uint8_t i;
+
+  // reference at slowest clock, read twice
+  lcd->clock = lcd->clock_read = ST7735_CLOCK_STEPS - 1;
+  ST7735_ReadIds (lcd, reference);
+  for (i = 0; i < 6; i++) {
+    ones &= reference[i];
+    zeros |= reference[i];
+  }
+  // MISO not wired reads pull-up or ground
+  if ((ones == 0xFF) || (zeros == 0x00) || (ST7735_CheckIds (lcd, reference) == ST7735_ERROR)) {
+    return ST7735_ERROR;
+  }
+  // keep content of test pixels, nothing written yet if it fails
+  if (ST7735_ReadWindow (lcd, 0, ST7735_CAL_PIXELS - 1, 0, 0, under) == ST7735_ERROR) {
+    return ST7735_ERROR;
+  }
+  // pattern fails even at slowest clock
+  if (ST7735_CheckGram (lcd, 0) == ST7735_ERROR) {
+    ST7735_SetWindow (lcd, 0, ST7735_CAL_PIXELS - 1, 0, 0);
+    ST7735_WritePixels (lcd, under, ST7735_CAL_PIXELS, ST7735_SRAM);
+    return ST7735_ERROR;
+  }
+  // fastest read clock, writes at slowest
+  for (lcd->clock_read = 0; lcd->clock_read < ST7735_CLOCK_STEPS - 1; lcd->clock_read++) {
+    for (trial = 0; trial < ST7735_CAL_TRIALS; trial++) {
+      if ((ST7735_CheckIds (lcd, reference) == ST7735_ERROR) || (ST7735_CheckGram (lcd, trial) == ST7735_ERROR)) {
+        break;
+      }
+    }
+    // all trials passed
+    if (trial == ST7735_CAL_TRIALS) {
+      break;
+    }
+  }
+  // fastest write clock, read back at found read clock
+  for (lcd->clock = 0; lcd->clock < ST7735_CLOCK_STEPS - 1; lcd->clock++) {
+    for (trial = 0; trial < ST7735_CAL_TRIALS; trial++) {
+      if (ST7735_CheckGram (lcd, trial) == ST7735_ERROR) {
+        break;
+      }
+    }
+    // all trials passed
+    if (trial == ST7735_CAL_TRIALS) {
+      break;
+    }
+  }
+  // restore test pixels
+  ST7735_SetWindow (lcd, 0, ST7735_CAL_PIXELS - 1, 0, 0);
+  ST7735_WritePixels (lcd, under, ST7735_CAL_PIXELS, ST7735_SRAM);
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Find fastest reliable SPI clock by readback. Reference identification is
+ *          read at slowest clock, then clock steps are tried from fastest: read clock
+ *          must return the same RDDID / RDID1-3 and GRAM pattern, write clock must
+ *          write pattern which reads back right. Result is kept in lcd->clock and
+ *          lcd->clock_read, used by bus on each select. Needs readback wired.
+ *
+ * @param   struct st7735 *
+ *
+ * @return  uint8_t - ST7735_ERROR if no readback, clocks left unchanged
+ */
+uint8_t ST7735_Calibrate (struct st7735 * lcd)
+{
+  uint8_t clock = lcd->clock;
+  uint8_t clock_read = lcd->clock_read;
+  uint8_t result;
+
+  // backend without data in
+  if (!ST7735_Readable (lcd)) {
+    return ST7735_ERROR;
+  }
+#if defined(ST7735_FRAMEBUFFER)
+  // talk to display, not to memory
+  struct st7735_fb * fb = lcd->fb;
+  lcd->fb = NULL;
+#endif
+  result = ST7735_CalibrateSteps (lcd);
+#if defined(ST7735_FRAMEBUFFER)
+  lcd->fb = fb;
+#endif
+  // previous clocks
+  if (result == ST7735_ERROR) {
+    lcd->clock = clock;
+    lcd->clock_read = clock_read;
+  }
+  return result;
 }
 
 /**
  * @desc    Draw pixel
  *
  * @param   struct st7735 * lcd
- * @param   uint8_t x position / 0 <= cols <= MAX_X-1
- * @param   uint8_t y position / 0 <= rows <= MAX_Y-1
+ * @param   uint8_t x position / 0 <= cols <= width-1
+ * @param   uint8_t y position / 0 <= rows <= height-1
  * @param   uint16_t color
  *
  * @return  void
  */
 void ST7735_DrawPixel (struct st7735 * lcd, uint8_t x, uint8_t y, uint16_t color)
 {
+  ST7735_STATS_ENTER (ST7735_STAT_PIXEL);
+  // check if pixel is outside of clip rectangle
+  if ((x < lcd->clip.x0) ||
+      (x > lcd->clip.x1) ||
+      (y < lcd->clip.y0) ||
+      (y > lcd->clip.y1)) {
+    ST7735_STATS_LEAVE (ST7735_STAT_PIXEL);
+    // nothing visible
+    return;
+  }
+#if defined(ST7735_FRAMEBUFFER)
+  // render into memory
+  if (lcd->fb != NULL) {
+    // write pixel
+    lcd->fb->frame[y * lcd->width + x] = color;
+    ST7735_STATS_LEAVE (ST7735_STAT_PIXEL);
+    // done
+    return;
+  }
+#endif
   // set window
   ST7735_SetWindow (lcd, x, x, y, y);
   // draw pixel by 565 mode
   ST7735_SendColor565 (lcd, color, 1);
+  ST7735_STATS_LEAVE (ST7735_STAT_PIXEL);
 }
 
 /**
@@ -399,10 +1393,10 @@ void ST7735_RAM_Content_Hide (struct st7735 * lcd)
  */
 void ST7735_ClearScreen (struct st7735 * lcd, uint16_t color)
 {
-  // set whole window
-  ST7735_SetWindow (lcd, 0, SIZE_X, 0, SIZE_Y);
-  // draw individual pixels
-  ST7735_SendColor565 (lcd, color, CACHE_SIZE_MEM);
+  ST7735_STATS_ENTER (ST7735_STAT_CLEAR);
+  // fill whole window limited by clip rectangle
+  ST7735_FillWindow (lcd, 0, lcd->width - 1, 0, lcd->height - 1, color);
+  ST7735_STATS_LEAVE (ST7735_STAT_CLEAR);
 }
 
 /**
@@ -417,14 +1411,29 @@ void ST7735_ClearScreen (struct st7735 * lcd, uint16_t color)
  */
 char ST7735_DrawChar (struct st7735 * lcd, char character, uint16_t color, enum Size size)
 {
+  ST7735_STATS_ENTER (ST7735_STAT_CHAR);
   // variables
   uint8_t letter, idxCol, idxRow;
   // check if character is out of range
-  if ((character < 0x20) &&
-      (character > 0x7f)) { 
+  if (((uint8_t) character < 0x20) ||
+      ((uint8_t) character > 0x7f)) {
+    // blank cell, as tile rasteriser does
+    cacheMemIndexCol += (size == X3) ? (CHARS_COLS_LEN + CHARS_COLS_LEN + 1) : (CHARS_COLS_LEN + 1);
+    ST7735_STATS_LEAVE (ST7735_STAT_CHAR);
     // out of range
     return 0;
   }
+  // character cell outside of clip rectangle - only move cursor
+  if ((cacheMemIndexCol > lcd->clip.x1) ||
+      (cacheMemIndexRow > lcd->clip.y1) ||
+      (cacheMemIndexCol + ((CHARS_COLS_LEN << 1) - 1) < lcd->clip.x0) ||
+      (cacheMemIndexRow + ((CHARS_ROWS_LEN << 1) - 1) < lcd->clip.y0)) {
+    // update x position
+    cacheMemIndexCol += (size == X3) ? (CHARS_COLS_LEN + CHARS_COLS_LEN + 1) : (CHARS_COLS_LEN + 1);
+    ST7735_STATS_LEAVE (ST7735_STAT_CHAR);
+    // nothing visible
+    return ST7735_SUCCESS;
+  }
   // last column of character array - 5 columns 
   idxCol = CHARS_COLS_LEN;
   // last row of character array - 8 rows / bits
@@ -508,6 +1517,7 @@ char ST7735_DrawChar (struct st7735 * lcd, char character, uint16_t color, enum
     cacheMemIndexCol = cacheMemIndexCol + CHARS_COLS_LEN + CHARS_COLS_LEN + 1;
   }
 
+  ST7735_STATS_LEAVE (ST7735_STAT_CHAR);
   // return exit
   return ST7735_SUCCESS;
 }
@@ -515,19 +1525,20 @@ char ST7735_DrawChar (struct st7735 * lcd, char character, uint16_t color, enum
 /**
  * @desc    Set text position x, y
  *
+ * @param   struct st7735 *
  * @param   uint8_t x - position
  * @param   uint8_t y - position
  *
  * @return  char
  */
-char ST7735_SetPosition (uint8_t x, uint8_t y)
+char ST7735_SetPosition (struct st7735 * lcd, uint8_t x, uint8_t y)
 {
   // check if coordinates is out of range
-  if ((x > MAX_X) && (y > MAX_Y)) {
+  if ((x >= lcd->width) && (y >= lcd->height)) {
     // error
     return ST7735_ERROR;
 
-  } else if ((x > MAX_X) && (y <= MAX_Y)) {
+  } else if ((x >= lcd->width) && (y < lcd->height)) {
     // set position y
     cacheMemIndexRow = y;
     // set position x
@@ -545,22 +1556,23 @@ char ST7735_SetPosition (uint8_t x, uint8_t y)
 /**
  * @desc    Check text position x, y
  *
+ * @param   struct st7735 *
  * @param   unsigned char x - position
  * @param   unsigned char y - position
  * @param   unsigned char
  *
  * @return  char
  */
-char ST7735_CheckPosition (unsigned char x, unsigned char y, unsigned char max_y, enum Size size)
+char ST7735_CheckPosition (struct st7735 * lcd, unsigned char x, unsigned char y, unsigned char max_y, enum Size size)
 {
   // check if coordinates is out of range
-  if ((x > MAX_X) && (y > max_y)) {
+  if ((x >= lcd->width) && (y > max_y)) {
     // out of range
     return ST7735_ERROR;
 
   }
   // if next line
-  if ((x > MAX_X) && (y <= max_y)) {
+  if ((x >= lcd->width) && (y <= max_y)) {
     // set position y
     cacheMemIndexRow = y;
     // set position x
@@ -583,9 +1595,9 @@ char ST7735_CheckPosition (unsigned char x, unsigned char y, unsigned char max_y
  */
 void ST7735_DrawString (struct st7735 * lcd, char *str, uint16_t color, enum Size size)
 {
+  ST7735_STATS_ENTER (ST7735_STAT_STRING);
   // variables
   unsigned int i = 0;
-  unsigned char check;
   unsigned char delta_y;
   unsigned char max_y_pos;
   unsigned char new_x_pos;
@@ -600,15 +1612,22 @@ void ST7735_DrawString (struct st7735 * lcd, char *str, uint16_t color, enum Siz
     // max y position character
     new_y_pos = cacheMemIndexRow + delta_y;
     // max y pos
-    max_y_pos = MAX_Y - delta_y;
-    // control if will be in range
-    check = ST7735_CheckPosition (new_x_pos, new_y_pos, max_y_pos, size);
-    // update position
-    if (ST7735_SUCCESS == check) {
-      // read characters and increment index
-      ST7735_DrawChar (lcd, str[i++], color, size);
+    max_y_pos = lcd->height - delta_y;
+    // out of range - rest of string not drawn
+    if ((new_x_pos > lcd->width) && (new_y_pos > max_y_pos)) {
+      break;
     }
+    // next line
+    if (new_x_pos > lcd->width) {
+      // set position y
+      cacheMemIndexRow = new_y_pos;
+      // set position x
+      cacheMemIndexCol = 2;
+    }
+    // read characters and increment index
+    ST7735_DrawChar (lcd, str[i++], color, size);
   }
+  ST7735_STATS_LEAVE (ST7735_STAT_STRING);
 }
 
 /**
@@ -626,6 +1645,7 @@ void ST7735_DrawString (struct st7735 * lcd, char *str, uint16_t color, enum Siz
  */
 char ST7735_DrawLine (struct st7735 * lcd, uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2, uint16_t color)
 {
+  ST7735_STATS_ENTER (ST7735_STAT_LINE);
   // determinant
   int16_t D;
   // deltas
@@ -633,6 +1653,32 @@ char ST7735_DrawLine (struct st7735 * lcd, uint8_t x1, uint8_t x2, uint8_t y1, u
   // steps
   int16_t trace_x = 1, trace_y = 1;
 
+  // horizontal line - one clipped span
+  if (y1 == y2) {
+    // fast draw
+    ST7735_DrawLineHorizontal (lcd, x1, x2, y1, color);
+    ST7735_STATS_LEAVE (ST7735_STAT_LINE);
+    // success return
+    return 1;
+  }
+  // vertical line - one clipped span
+  if (x1 == x2) {
+    // fast draw
+    ST7735_DrawLineVertical (lcd, x1, y1, y2, color);
+    ST7735_STATS_LEAVE (ST7735_STAT_LINE);
+    // success return
+    return 1;
+  }
+  // bounding box outside of clip rectangle
+  if (((x1 < lcd->clip.x0) && (x2 < lcd->clip.x0)) ||
+      ((x1 > lcd->clip.x1) && (x2 > lcd->clip.x1)) ||
+      ((y1 < lcd->clip.y0) && (y2 < lcd->clip.y0)) ||
+      ((y1 > lcd->clip.y1) && (y2 > lcd->clip.y1))) {
+    ST7735_STATS_LEAVE (ST7735_STAT_LINE);
+    // nothing visible
+    return 1;
+  }
+
   // delta x
   delta_x = x2 - x1;
   // delta y
@@ -699,6 +1745,7 @@ char ST7735_DrawLine (struct st7735 * lcd, uint8_t x1, uint8_t x2, uint8_t y1, u
       ST7735_DrawPixel (lcd, x1, y1, color);
     }
   }
+  ST7735_STATS_LEAVE (ST7735_STAT_LINE);
   // success return
   return 1;
 }
@@ -717,19 +1764,20 @@ char ST7735_DrawLine (struct st7735 * lcd, uint8_t x1, uint8_t x2, uint8_t y1, u
 void ST7735_DrawLineHorizontal (struct st7735 * lcd, uint8_t xs, uint8_t xe, uint8_t y, uint16_t color)
 {
   uint8_t temp;
+
+  ST7735_STATS_ENTER (ST7735_STAT_HLINE);
   // check if start is > as end  
   if (xs > xe) {
     // temporary safe
-    temp = xs;
+    temp = xe;
     // start change for end
     xe = xs;
     // end change for start
     xs = temp;
   }
-  // set window
-  ST7735_SetWindow (lcd, xs, xe, y, y);
-  // draw pixel by 565 mode
-  ST7735_SendColor565 (lcd, color, xe - xs);
+  // fill clipped span
+  ST7735_FillWindow (lcd, xs, xe, y, y, color);
+  ST7735_STATS_LEAVE (ST7735_STAT_HLINE);
 }
 
 /**
@@ -746,19 +1794,20 @@ void ST7735_DrawLineHorizontal (struct st7735 * lcd, uint8_t xs, uint8_t xe, uin
 void ST7735_DrawLineVertical (struct st7735 * lcd, uint8_t x, uint8_t ys, uint8_t ye, uint16_t color)
 {
   uint8_t temp;
+
+  ST7735_STATS_ENTER (ST7735_STAT_VLINE);
   // check if start is > as end
   if (ys > ye) {
     // temporary safe
-    temp = ys;
+    temp = ye;
     // start change for end
     ye = ys;
     // end change for start
     ys = temp;
   }
-  // set window
-  ST7735_SetWindow (lcd, x, x, ys, ye);
-  // draw pixel by 565 mode
-  ST7735_SendColor565 (lcd, color, ye - ys);
+  // fill clipped span
+  ST7735_FillWindow (lcd, x, x, ys, ye, color);
+  ST7735_STATS_LEAVE (ST7735_STAT_VLINE);
 }
 
 /**
@@ -776,6 +1825,8 @@ void ST7735_DrawLineVertical (struct st7735 * lcd, uint8_t x, uint8_t ys, uint8_
 void ST7735_DrawRectangle (struct st7735 * lcd, uint8_t xs, uint8_t xe, uint8_t ys, uint8_t ye, uint16_t color)
 {
   uint8_t temp;
+
+  ST7735_STATS_ENTER (ST7735_STAT_RECTANGLE);
   // check if start is > as end  
   if (xs > xe) {
     // temporary safe
@@ -794,10 +1845,9 @@ void ST7735_DrawRectangle (struct st7735 * lcd, uint8_t xs, uint8_t xe, uint8_t
     // end change for start
     ys = temp;
   }
-  // set window
-  ST7735_SetWindow (lcd, xs, xe, ys, ye);
-  // send color
-  ST7735_SendColor565 (lcd, color, (xe-xs+1)*(ye-ys+1));  
+  // fill clipped window
+  ST7735_FillWindow (lcd, xs, xe, ys, ye, color);
+  ST7735_STATS_LEAVE (ST7735_STAT_RECTANGLE);
 }
 
 /**
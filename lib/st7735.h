@@ -12,7 +12,7 @@
  * @version     2.0
  * @tested      AVR Atmega328
  *
- * @depend      font.h
+ * @depend      font.h, st7735_port.h, st7735_bus.h
  * --------------------------------------------------------------------------------------------+
  * @descr       Version 1.0 -> applicable for 1 display
  *              Version 2.0 -> applicable for more than 1 display
@@ -22,7 +22,8 @@
  *              http://w8bh.net/avr/AvrTFT.pdf
  */
 
-#include <avr/pgmspace.h>
+#include "st7735_port.h"
+#include "st7735_bus.h"
 
 #ifndef __ST7735_H__
 #define __ST7735_H__
@@ -31,6 +32,7 @@
   // -----------------------------------
   #define ST7735_SUCCESS        0
   #define ST7735_ERROR          1
+  #define ST7735_BUSY           2
 
   // PORT/PIN definition
   // -----------------------------------
@@ -103,8 +105,19 @@
   #define SIZE_X                MAX_X - 1         // columns max counter
   #define SIZE_Y                MAX_Y - 1         // rows max counter
   #define CACHE_SIZE_MEM        (MAX_X * MAX_Y)   // whole pixels
+  #define MADCTL_MY             0x80              // row address order
+  #define MADCTL_MX             0x40              // column address order
+  #define MADCTL_MV             0x20              // row / column exchange
+  #define MADCTL_RGB            0x00              // RGB order, 0x08 = BGR
   #define CHARS_COLS_LEN        5                 // number of columns for chars
   #define CHARS_ROWS_LEN        8                 // number of rows for chars
+  #define ST7735_FILL_CHUNK     32                // bytes of color chunk when bus has no fill
+  #define ST7735_READ_CHUNK     24                // bytes of readback chunk, 8 pixels
+  #define ST7735_CAL_PIXELS     16                // pixels of GRAM pattern, row 0 from x 0
+  #define ST7735_CAL_TRIALS     8                 // passes needed at clock step
+  #define ST7735_BURST_WHOLE    0                 // whole burst window visible
+  #define ST7735_BURST_CLIPPED  1                 // pixels out of clip dropped
+  #define ST7735_BURST_HIDDEN   2                 // nothing visible, nothing sent
 
 
   // FUNCTION macros
@@ -119,13 +132,19 @@
   #define IS_BIT_SET(port, bit)             ( ((port) & (1 << (bit))) ? 1 : 0 )
   // wait until bit is set
   #define WAIT_UNTIL_BIT_IS_SET(port, bit)  { while (IS_BIT_CLR(port, bit)); }
+  // input register of signal, PINx is just below DDRx
+  #define SIGNAL_PIN(signal)                ( *((signal)->ddr - 1) )
+  // initializer of struct st7735_wire from 565 color
+  #define ST7735_WIRE(color)                { (uint8_t) ((color) >> 8), (uint8_t) (color) }
+  // 565 color of struct st7735_wire
+  #define ST7735_WIRE_COLOR(wire)           ( ((uint16_t) (wire).high << 8) | (wire).low )
 
   /** @const Command list ST7735B */
   extern const uint8_t INIT_ST7735B[];
   /** @var array Chache memory char index row */
-  unsigned short int cacheMemIndexRow;
+  extern unsigned short int cacheMemIndexRow;
   /** @var array Chache memory char index column */
-  unsigned short int cacheMemIndexCol;
+  extern unsigned short int cacheMemIndexCol;
 
   /** @enum Font sizes */
   enum Size {
@@ -139,6 +158,22 @@
     X3 = 0x81
   };
 
+  /** @enum Rotation - one of ROTATE_x optionally ored with MIRROR_x */
+  enum Rotation {
+    // landscape 161x130, as set by ST7735_Init
+    ROTATE_0 = 0x00,
+    // portrait 130x161
+    ROTATE_90 = 0x01,
+    // landscape upside down
+    ROTATE_180 = 0x02,
+    // portrait upside down
+    ROTATE_270 = 0x03,
+    // mirror along vertical axis
+    MIRROR_X = 0x04,
+    // mirror along horizontal axis
+    MIRROR_Y = 0x08
+  };
+
   /** @struct Signal */
   struct signal {
     // ddr
@@ -149,6 +184,71 @@
     uint8_t pin;
   };
 
+  /** @struct Window */
+  struct window {
+    // x start position
+    uint8_t x0;
+    // x end position
+    uint8_t x1;
+    // y start position
+    uint8_t y0;
+    // y end position
+    uint8_t y1;
+  };
+
+  /** @enum Init states */
+  enum st7735_state {
+    // power on - struct zero initialized
+    ST7735_STATE_IDLE = 0,
+    // reset high, waiting
+    ST7735_STATE_RESET_HIGH,
+    // reset low, waiting
+    ST7735_STATE_RESET_LOW,
+    // walking through command table
+    ST7735_STATE_COMMANDS,
+    // ready for drawing
+    ST7735_STATE_READY
+  };
+
+  /** @struct Non-blocking init */
+  struct st7735_boot {
+    // next command of table
+    const uint8_t * command;
+    // commands left
+    uint8_t remaining;
+    // state
+    enum st7735_state state;
+    // time in ms when current step ends
+    uint16_t deadline;
+  };
+
+  /** @struct Burst of pixels into window */
+  struct st7735_burst {
+    // bytes, high byte first
+    uint8_t buffer[ST7735_FILL_CHUNK];
+    // bytes in buffer
+    uint8_t length;
+    // ST7735_BURST_x
+    uint8_t mode;
+    // visible part of window
+    struct window visible;
+    // position of next pixel, first and last column of window
+    uint8_t x;
+    uint8_t y;
+    uint8_t left;
+    uint8_t right;
+  };
+
+  /** @struct 565 pixel in wire order - array of them is sent as is */
+  struct st7735_wire {
+    // red 5 bits, green 3 high bits
+    uint8_t high;
+    // green 3 low bits, blue 5 bits
+    uint8_t low;
+  };
+
+  struct st7735_fb;
+
   /** @struct Lcd */
   struct st7735 {
     // Chip Select
@@ -159,6 +259,26 @@
     struct signal * dc;
     // Reset
     struct signal * rs;
+    // Clip rectangle - set to whole screen by ST7735_Init
+    struct window clip;
+    // Columns / rows of current rotation - set by ST7735_Init
+    uint8_t width;
+    uint8_t height;
+    // Memory data access control sent to display
+    uint8_t madctl;
+    // SPI clock steps of writes and reads, 0 = fastest - set by ST7735_Calibrate
+    uint8_t clock;
+    uint8_t clock_read;
+    // Bus backend - NULL = ST7735_BUS_SPI on AVR
+    const struct st7735_bus * bus;
+    // Bus backend data, e.g. struct st7735_spidev *
+    void * bus_data;
+    // Non-blocking init
+    struct st7735_boot boot;
+#if defined(ST7735_FRAMEBUFFER)
+    // Framebuffer - NULL = draw directly to display
+    struct st7735_fb * fb;
+#endif
   };
 
   /**
@@ -170,6 +290,59 @@
    */
   void ST7735_Init (struct st7735 *);
 
+  /**
+   * @desc    Set rotation and mirroring
+   *
+   * @param   struct st7735 *
+   * @param   uint8_t - enum Rotation
+   *
+   * @return  void
+   */
+  void ST7735_SetRotation (struct st7735 *, uint8_t);
+
+  /**
+   * @desc    Init group of displays together
+   *
+   * @param   struct st7735 **
+   * @param   uint8_t
+   *
+   * @return  void
+   */
+  void ST7735_InitGroup (struct st7735 **, uint8_t);
+
+  /**
+   * @desc    Start non-blocking init
+   *
+   * @param   struct st7735 *
+   * @param   uint16_t
+   *
+   * @return  void
+   */
+  void ST7735_InitStart (struct st7735 *, uint16_t);
+
+  /**
+   * @desc    Step non-blocking init
+   *
+   * @param   struct st7735 *
+   * @param   uint16_t
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_InitTick (struct st7735 *, uint16_t);
+
+  /**
+   * @desc    Hardware Reset through bus
+   *
+   * @param   struct st7735 *
+   *
+   * @return  void
+   */
+  void ST7735_HardReset (struct st7735 *);
+
+#if defined(__AVR__)
+  // SPI clock step set in SPCR / SPSR, compared inline by static driver
+  extern uint8_t ST7735_SPI_Step;
+
   /**
    * @desc    Hardware Reset
    *
@@ -188,6 +361,15 @@
    */
   void ST7735_SPI_Init (void);
 
+  /**
+   * @desc    Set SPI clock step, cached
+   *
+   * @param   uint8_t
+   *
+   * @return  void
+   */
+  void ST7735_SPI_Clock (uint8_t);
+
   /**
    * @desc    Init PINS
    *
@@ -196,6 +378,7 @@
    * @return  void
    */
   void ST7735_Pins_Init (struct st7735 *);
+#endif
 
   /**
    * @desc    Send list commands
@@ -237,6 +420,17 @@
    */
   uint8_t ST7735_Data16BitsSend (struct st7735 *, uint16_t);
 
+  /**
+   * @desc    Bulk data send
+   *
+   * @param   struct st7735 *
+   * @param   const uint8_t *
+   * @param   uint16_t
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_DataSend (struct st7735 *, const uint8_t *, uint16_t);
+
   /**
    * @desc    Set window
    *
@@ -250,6 +444,52 @@
    */
   uint8_t ST7735_SetWindow (struct st7735 *, uint8_t, uint8_t, uint8_t, uint8_t);
 
+  /**
+   * @desc    Set clip rectangle
+   *
+   * @param   struct st7735 *
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   uint8_t
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_SetClip (struct st7735 *, uint8_t, uint8_t, uint8_t, uint8_t);
+
+  /**
+   * @desc    Reset clip rectangle to whole screen
+   *
+   * @param   struct st7735 *
+   *
+   * @return  void
+   */
+  void ST7735_ResetClip (struct st7735 *);
+
+  /**
+   * @desc    Clip window to clip rectangle
+   *
+   * @param   struct st7735 *
+   * @param   struct window *
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_ClipWindow (struct st7735 *, struct window *);
+
+  /**
+   * @desc    Fill clipped window with color
+   *
+   * @param   struct st7735 *
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   uint16_t
+   *
+   * @return  void
+   */
+  void ST7735_FillWindow (struct st7735 *, uint8_t, uint8_t, uint8_t, uint8_t, uint16_t);
+
   /**
    * @desc    Write color pixels
    *
@@ -261,6 +501,109 @@
    */
   void ST7735_SendColor565 (struct st7735 *, uint16_t, uint16_t);
 
+  /**
+   * @desc    Write array of color pixels
+   *
+   * @param   struct st7735 *
+   * @param   const uint16_t *
+   * @param   uint16_t
+   * @param   uint8_t
+   *
+   * @return  void
+   */
+  void ST7735_WritePixels (struct st7735 *, const uint16_t *, uint16_t, uint8_t);
+
+  /**
+   * @desc    Fill wire order buffer with color
+   *
+   * @param   struct st7735_wire *
+   * @param   uint16_t
+   * @param   uint16_t
+   *
+   * @return  void
+   */
+  void ST7735_Wire_Fill (struct st7735_wire *, uint16_t, uint16_t);
+
+  /**
+   * @desc    Convert 565 colors to wire order
+   *
+   * @param   struct st7735_wire *
+   * @param   const uint16_t *
+   * @param   uint16_t
+   *
+   * @return  void
+   */
+  void ST7735_Wire_Convert (struct st7735_wire *, const uint16_t *, uint16_t);
+
+  /**
+   * @desc    Write wire order pixels
+   *
+   * @param   struct st7735 *
+   * @param   const struct st7735_wire *
+   * @param   uint16_t
+   *
+   * @return  void
+   */
+  void ST7735_WriteWire (struct st7735 *, const struct st7735_wire *, uint16_t);
+
+  /**
+   * @desc    Start burst of pixels into window
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_burst *
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   uint8_t
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_Burst_Begin (struct st7735 *, struct st7735_burst *, uint8_t, uint8_t, uint8_t, uint8_t);
+
+  /**
+   * @desc    Add pixel to burst
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_burst *
+   * @param   uint16_t
+   *
+   * @return  void
+   */
+  void ST7735_Burst_Push (struct st7735 *, struct st7735_burst *, uint16_t);
+
+  /**
+   * @desc    Finish burst
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_burst *
+   *
+   * @return  void
+   */
+  void ST7735_Burst_End (struct st7735 *, struct st7735_burst *);
+
+  /**
+   * @desc    Read window of display memory as 565 pixels
+   *
+   * @param   struct st7735 *
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   uint16_t *
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_ReadWindow (struct st7735 *, uint8_t, uint8_t, uint8_t, uint8_t, uint16_t *);
+
+  /**
+   * @desc    Find fastest reliable SPI clock by readback
+   *
+   * @param   struct st7735 *
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_Calibrate (struct st7735 *);
+
   /**
    * @desc    Draw pixel
    *
@@ -313,23 +656,25 @@
   /**
    * @desc    Check text position x, y
    *
+   * @param   struct st7735 *
    * @param   unsigned char
    * @param   unsigned char
    * @param   unsigned char
    *
    * @return  char
    */
-  char ST7735_CheckPosition (unsigned char, unsigned char, unsigned char, enum Size);
+  char ST7735_CheckPosition (struct st7735 *, unsigned char, unsigned char, unsigned char, enum Size);
 
   /**
    * @desc    Set text position x, y
    *
+   * @param   struct st7735 *
    * @param   uint8_t
    * @param   uint8_t
    *
    * @return  char
    */
-  char ST7735_SetPosition (uint8_t, uint8_t);
+  char ST7735_SetPosition (struct st7735 *, uint8_t, uint8_t);
 
   /**
    * @desc    Draw character
@@ -0,0 +1,314 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - anti-aliased lines and text
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_aa.c
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735_aa.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Line position along minor axis is kept in 8.8 fixed point, stepped by
+ *              quotient and remainder so end pixel is hit exactly. Pixels in which
+ *              integer part stays the same form run; run is sent as 2 x n window, second
+ *              scanline is left out when it has no coverage (horizontal, vertical lines).
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include "st7735_port.h"
+#include "st7735_aa.h"
+
+/** @struct Run of line pixels */
+struct st7735_run {
+  // first pixel along major axis
+  uint8_t major;
+  // integer position along minor axis
+  uint8_t minor;
+  // line runs along y
+  uint8_t steep;
+  // number of pixels
+  uint8_t count;
+  // coverage of second pixel, first has the rest
+  uint8_t levels[ST7735_AA_RUN];
+};
+
+/**
+ * @desc    Precompute blend table
+ *
+ * @param   struct st7735_blend *
+ * @param   uint16_t color - foreground
+ * @param   uint16_t color - background
+ *
+ * @return  void
+ */
+void ST7735_Blend_Init (struct st7735_blend * blend, uint16_t fg, uint16_t bg)
+{
+  uint8_t max = ST7735_AA_LEVELS - 1;
+  uint16_t r, g, b;
+  uint8_t i;
+
+  // loop through levels
+  for (i = 0; i <= max; i++) {
+    // channels weighted by coverage
+    r = (((fg >> 11) & 0x1F) * i + ((bg >> 11) & 0x1F) * (max - i) + (max >> 1)) / max;
+    g = (((fg >> 5) & 0x3F) * i + ((bg >> 5) & 0x3F) * (max - i) + (max >> 1)) / max;
+    b = ((fg & 0x1F) * i + (bg & 0x1F) * (max - i) + (max >> 1)) / max;
+    // 565
+    blend->lut[i] = (r << 11) | (g << 5) | b;
+  }
+}
+
+/**
+ * @desc    Send run of line in one window
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_blend *
+ * @param   struct st7735_run *
+ *
+ * @return  void
+ */
+static void ST7735_AA_Flush (struct st7735 * lcd, const struct st7735_blend * blend, struct st7735_run * run)
+{
+  struct st7735_burst burst;
+  struct window win;
+  uint8_t max = ST7735_AA_LEVELS - 1;
+  uint8_t second = 0;
+  uint8_t first;
+  uint8_t i, j;
+
+  // nothing to send
+  if (run->count == 0) {
+    return;
+  }
+  // second pixel covered anywhere
+  for (i = 0; i < run->count; i++) {
+    second |= run->levels[i];
+  }
+  // along major axis
+  win.x0 = run->major;
+  win.x1 = run->major + run->count - 1;
+  // along minor axis
+  win.y0 = run->minor;
+  win.y1 = (second && (run->minor < 0xFF)) ? run->minor + 1 : run->minor;
+  // steep line - axes exchanged
+  if (run->steep) {
+    win = (struct window) { .x0 = win.y0, .x1 = win.y1, .y0 = win.x0, .y1 = win.x1 };
+  }
+  // clip, pixels left out are skipped below
+  if (ST7735_ClipWindow (lcd, &win) == ST7735_ERROR) {
+    run->count = 0;
+    return;
+  }
+  // minor pixels left after clip
+  first = ((run->steep ? win.x0 : win.y0) == run->minor) ? 1 : 0;
+  second = ((run->steep ? win.x1 : win.y1) != run->minor) ? 1 : 0;
+  ST7735_Burst_Begin (lcd, &burst, win.x0, win.x1, win.y0, win.y1);
+  // steep - row per pixel, columns minor and minor + 1
+  if (run->steep) {
+    for (i = win.y0 - run->major; i <= win.y1 - run->major; i++) {
+      if (first) {
+        ST7735_Burst_Push (lcd, &burst, blend->lut[max - run->levels[i]]);
+      }
+      if (second) {
+        ST7735_Burst_Push (lcd, &burst, blend->lut[run->levels[i]]);
+      }
+    }
+  // flat - scanline minor, then scanline minor + 1
+  } else {
+    for (j = 0; j < 2; j++) {
+      // scanline left out
+      if ((j == 0) ? !first : !second) {
+        continue;
+      }
+      for (i = win.x0 - run->major; i <= win.x1 - run->major; i++) {
+        ST7735_Burst_Push (lcd, &burst, blend->lut[j ? run->levels[i] : max - run->levels[i]]);
+      }
+    }
+  }
+  ST7735_Burst_End (lcd, &burst);
+  // run sent
+  run->count = 0;
+}
+
+/**
+ * @desc    Draw anti-aliased line by Xiaolin Wu algoritm
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_blend *
+ * @param   uint8_t x start position
+ * @param   uint8_t x end position
+ * @param   uint8_t y start position
+ * @param   uint8_t y end position
+ *
+ * @return  void
+ */
+void ST7735_DrawLineAA (struct st7735 * lcd, const struct st7735_blend * blend, uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2)
+{
+  struct st7735_run run;
+  int16_t dx = (x2 > x1) ? (x2 - x1) : (x1 - x2);
+  int16_t dy = (y2 > y1) ? (y2 - y1) : (y1 - y2);
+  uint8_t a0, a1, b0, b1;
+  uint16_t position;
+  uint16_t offset = 0;
+  uint16_t step = 0;
+  uint16_t rest = 0;
+  uint16_t error;
+  uint8_t length;
+  uint8_t minor;
+  uint8_t major;
+
+  // runs along y
+  run.steep = (dy > dx) ? 1 : 0;
+  run.count = 0;
+  // major axis a, minor axis b
+  a0 = run.steep ? y1 : x1;
+  a1 = run.steep ? y2 : x2;
+  b0 = run.steep ? x1 : y1;
+  b1 = run.steep ? x2 : y2;
+  // draw from lower major
+  if (a0 > a1) {
+    major = a0; a0 = a1; a1 = major;
+    minor = b0; b0 = b1; b1 = minor;
+  }
+  length = a1 - a0;
+  // minor step per pixel in 8.8 as quotient and remainder of length, no error build up
+  if (length) {
+    step = ((uint16_t) ((b1 > b0) ? (b1 - b0) : (b0 - b1)) << 8) / length;
+    rest = ((uint16_t) ((b1 > b0) ? (b1 - b0) : (b0 - b1)) << 8) % length;
+  }
+  // rounded to nearest
+  error = length >> 1;
+
+  // loop through major axis
+  for (major = a0; ; major++) {
+    // offset never passes end point
+    position = (b1 >= b0) ? ((uint16_t) b0 << 8) + offset : ((uint16_t) b0 << 8) - offset;
+    minor = position >> 8;
+    // run ends on new minor or full buffer
+    if (run.count && ((minor != run.minor) || (run.count == ST7735_AA_RUN))) {
+      ST7735_AA_Flush (lcd, blend, &run);
+    }
+    // new run
+    if (run.count == 0) {
+      run.major = major;
+      run.minor = minor;
+    }
+    // coverage of second pixel
+    run.levels[run.count++] = (position & 0xFF) >> 4;
+    // end of line
+    if (major == a1) {
+      break;
+    }
+    // exact step
+    offset += step;
+    error += rest;
+    if (error >= length) {
+      error -= length;
+      offset++;
+    }
+  }
+  // rest of run
+  ST7735_AA_Flush (lcd, blend, &run);
+}
+
+/**
+ * @desc    Coverage of glyph pixel
+ *
+ * @param   struct st7735_aa_font *
+ * @param   uint8_t character
+ * @param   uint8_t column
+ * @param   uint8_t row
+ *
+ * @return  uint8_t - level 0 - 15
+ */
+static uint8_t ST7735_AA_Level (const struct st7735_aa_font * font, uint8_t character, uint8_t col, uint8_t row)
+{
+  uint16_t bits = (uint16_t) font->width * font->height * font->bpp;
+  uint16_t offset;
+  uint8_t mask = (1 << font->bpp) - 1;
+  uint8_t value;
+
+  // out of font - blank
+  if ((character < font->first) || (character > font->last)) {
+    return 0;
+  }
+  // bit position of pixel
+  offset = (uint16_t) (row * font->width + col) * font->bpp;
+  // read from ROM memory
+  value = pgm_read_byte (&font->bitmap[(character - font->first) * ((bits + 7) >> 3) + (offset >> 3)]);
+  // MSB first
+  value = (value >> (8 - font->bpp - (offset & 7))) & mask;
+  // scale to 0 - 15
+  return value * ((ST7735_AA_LEVELS - 1) / mask);
+}
+
+/**
+ * @desc    Draw anti-aliased string in one window
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_aa_font *
+ * @param   struct st7735_blend *
+ * @param   uint8_t x - left top corner
+ * @param   uint8_t y - left top corner
+ * @param   const char * string
+ *
+ * @return  void
+ */
+void ST7735_DrawStringAA (struct st7735 * lcd, const struct st7735_aa_font * font, const struct st7735_blend * blend, uint8_t x, uint8_t y, const char * str)
+{
+  struct st7735_burst burst;
+  struct window win;
+  uint16_t length = 0;
+  uint16_t right;
+  uint8_t advance = font->width + 1;
+  uint8_t col, row;
+  uint8_t glyph;
+  uint8_t gx;
+
+  // characters
+  while (str[length] != '\0') {
+    length++;
+  }
+  // empty string
+  if (length == 0) {
+    return;
+  }
+  // last column, one blank column between glyphs
+  right = x + length * advance - 2;
+  // whole string
+  win.x0 = x;
+  win.x1 = (right > 0xFF) ? 0xFF : right;
+  win.y0 = y;
+  win.y1 = ((y + font->height - 1) > 0xFF) ? 0xFF : y + font->height - 1;
+  // nothing visible
+  if (ST7735_ClipWindow (lcd, &win) == ST7735_ERROR) {
+    return;
+  }
+  ST7735_Burst_Begin (lcd, &burst, win.x0, win.x1, win.y0, win.y1);
+  // loop through rows
+  for (row = win.y0 - y; row <= win.y1 - y; row++) {
+    // glyph and its column at left edge
+    glyph = (win.x0 - x) / advance;
+    gx = (win.x0 - x) % advance;
+    // loop through columns
+    for (col = win.x0; ; col++) {
+      // blank column or glyph pixel
+      ST7735_Burst_Push (lcd, &burst, blend->lut[(gx == font->width) ? 0 : ST7735_AA_Level (font, str[glyph], gx, row)]);
+      // end of row
+      if (col == win.x1) {
+        break;
+      }
+      // next glyph
+      if (++gx == advance) {
+        gx = 0;
+        glyph++;
+      }
+    }
+  }
+  ST7735_Burst_End (lcd, &burst);
+}
@@ -0,0 +1,95 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - anti-aliased lines and text
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_aa.h
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Coverage is blended against background color given by caller, no readback.
+ *              struct st7735_blend holds 16 precomputed colors from background to foreground.
+ *              Lines (Xiaolin Wu) are sent as runs of two scanlines (two columns if steep) in
+ *              one window each, string in one window for all glyphs.
+ *
+ *              Font bitmap: glyphs first..last, each width x height pixels of bpp (1, 2, 4)
+ *              bits row by row, MSB first, glyph starts on byte boundary.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include "st7735.h"
+
+#ifndef __ST7735_AA_H__
+#define __ST7735_AA_H__
+
+  // Blending
+  // -----------------------------------
+  #define ST7735_AA_LEVELS      16                // coverage levels of blend table
+  #define ST7735_AA_RUN         32                // max pixels of line run in one window
+
+  /** @struct Blend table */
+  struct st7735_blend {
+    // level 0 = background, 15 = foreground
+    uint16_t lut[ST7735_AA_LEVELS];
+  };
+
+  /** @struct Anti-aliased font */
+  struct st7735_aa_font {
+    // glyphs in flash
+    const uint8_t * bitmap;
+    // glyph size
+    uint8_t width;
+    uint8_t height;
+    // bits per pixel 1, 2, 4
+    uint8_t bpp;
+    // first and last character
+    uint8_t first;
+    uint8_t last;
+  };
+
+  /**
+   * @desc    Precompute blend table
+   *
+   * @param   struct st7735_blend *
+   * @param   uint16_t
+   * @param   uint16_t
+   *
+   * @return  void
+   */
+  void ST7735_Blend_Init (struct st7735_blend *, uint16_t, uint16_t);
+
+  /**
+   * @desc    Draw anti-aliased line
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_blend *
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   uint8_t
+   *
+   * @return  void
+   */
+  void ST7735_DrawLineAA (struct st7735 *, const struct st7735_blend *, uint8_t, uint8_t, uint8_t, uint8_t);
+
+  /**
+   * @desc    Draw anti-aliased string
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_aa_font *
+   * @param   struct st7735_blend *
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   const char *
+   *
+   * @return  void
+   */
+  void ST7735_DrawStringAA (struct st7735 *, const struct st7735_aa_font *, const struct st7735_blend *, uint8_t, uint8_t, const char *);
+
+#endif
@@ -0,0 +1,144 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - delta frame animations
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       19.10.2026
+ * @file        st7735_anim.c
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735_anim.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Player is stepped like ST7735_InitTick by millisecond time source. Each
+ *              changed rectangle is one window burst, runs are expanded on the fly, so
+ *              flash holds only RLE payload and RAM only player state.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include "st7735_port.h"
+#include "st7735_anim.h"
+
+/**
+ * @desc    Draw frame
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_anim *
+ * @param   const uint8_t * code - frame
+ * @param   uint8_t * - periods frame stays
+ *
+ * @return  const uint8_t * - behind frame
+ */
+static const uint8_t * ST7735_Anim_Frame (struct st7735 * lcd, struct st7735_anim * anim, const uint8_t * code, uint8_t * hold)
+{
+  struct st7735_burst burst;
+  struct window win;
+  uint8_t rects = pgm_read_byte (code++);
+  uint8_t x, y, w, h;
+
+  // periods on screen
+  *hold = pgm_read_byte (code++);
+  // loop through changed rectangles
+  while (rects--) {
+    x = pgm_read_byte (code++);
+    y = pgm_read_byte (code++);
+    w = pgm_read_byte (code++);
+    h = pgm_read_byte (code++);
+    // fits, checked at start
+    ST7735_Burst_Begin (lcd, &burst, anim->x + x, anim->x + x + w - 1, anim->y + y, anim->y + y + h - 1);
+    // pixels of whole rectangle
+    win = (struct window) { .x0 = 0, .x1 = w - 1, .y0 = 0, .y1 = h - 1 };
+    code = ST7735_RLE_Burst (lcd, &burst, code, w, &win);
+    ST7735_Burst_End (lcd, &burst);
+  }
+  // behind frame
+  return code;
+}
+
+/**
+ * @desc    Start animation, first frame is drawn by first tick
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_anim * - data, x, y, loop filled
+ * @param   uint16_t now - milliseconds
+ *
+ * @return  uint8_t - ST7735_ERROR if animation does not fit on screen
+ */
+uint8_t ST7735_Anim_Start (struct st7735 * lcd, struct st7735_anim * anim, uint16_t now)
+{
+  uint8_t w = pgm_read_byte (anim->data);
+  uint8_t h = pgm_read_byte (anim->data + 1);
+
+  // whole animation on screen, rectangles are not clipped
+  if ((w == 0) || (h == 0) ||
+      ((uint16_t) anim->x + w > lcd->width) ||
+      ((uint16_t) anim->y + h > lcd->height)) {
+    // nothing to play
+    anim->next = NULL;
+    return ST7735_ERROR;
+  }
+  // first frame
+  anim->next = anim->data + ST7735_ANIM_HEADER;
+  anim->rewind = anim->next;
+  anim->frame = 0;
+  // immediately
+  anim->deadline = now;
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Step animation, call as often as possible
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_anim *
+ * @param   uint16_t now - milliseconds
+ *
+ * @return  uint8_t - ST7735_BUSY / ST7735_SUCCESS when finished / ST7735_ERROR not started
+ */
+uint8_t ST7735_Anim_Tick (struct st7735 * lcd, struct st7735_anim * anim, uint16_t now)
+{
+  uint16_t period;
+  uint16_t frames;
+  uint8_t hold;
+
+  // not started
+  if (anim->next == NULL) {
+    return ST7735_ERROR;
+  }
+  // current frame still shown
+  if ((int16_t) (now - anim->deadline) < 0) {
+    return ST7735_BUSY;
+  }
+  period = ST7735_Flash_Word (anim->data + 2);
+  frames = ST7735_Flash_Word (anim->data + 4);
+  // behind last frame
+  if (anim->frame == frames) {
+    // last frame stays
+    if (!anim->loop) {
+      return ST7735_SUCCESS;
+    }
+    // wrap frame shows first frame again
+    ST7735_Anim_Frame (lcd, anim, anim->next, &hold);
+    // continue by second one
+    anim->next = anim->rewind;
+    anim->frame = 1;
+  } else {
+    anim->next = ST7735_Anim_Frame (lcd, anim, anim->next, &hold);
+    // second frame follows first one
+    if (anim->frame++ == 0) {
+      anim->rewind = anim->next;
+    }
+  }
+  // keep cadence
+  anim->deadline += (uint16_t) hold * period;
+  // drawing slower than period, no catching up
+  if ((int16_t) (now - anim->deadline) > 0) {
+    anim->deadline = now;
+  }
+  // more frames
+  return ST7735_BUSY;
+}
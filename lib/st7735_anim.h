@@ -0,0 +1,85 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - delta frame animations
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       19.10.2026
+ * @file        st7735_anim.h
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735_rle.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Animation is PROGMEM array made by tools/st7735_anim. First frame is whole,
+ *              each next one only rectangles which changed against previous frame, so
+ *              spinner costs few dozen pixels per frame instead of whole area.
+ *
+ *                header      w h period_hi period_lo frames_hi frames_lo
+ *                frame       rects hold, then rects times:
+ *                rect        x y w h, then w * h pixels RLE coded (st7735_rle.h)
+ *
+ *              Frame stays hold periods (identical frames are merged). Hold * period must
+ *              not exceed ST7735_ANIM_SPAN ms, longer wait looks expired to 16 bit clock;
+ *              encoder starts new empty frame when merged hold reaches it. Behind last frame
+ *              is wrap frame from last to first one, played when animation loops.
+ *              Coordinates are relative to left top corner of animation, colors high
+ *              byte first.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include "st7735.h"
+#include "st7735_rle.h"
+
+#ifndef __ST7735_ANIM_H__
+#define __ST7735_ANIM_H__
+
+  // Animation format
+  // -----------------------------------
+  #define ST7735_ANIM_HEADER    6                 // bytes of header
+  #define ST7735_ANIM_SPAN      32767             // max hold * period in ms
+
+  /** @struct Animation player */
+  struct st7735_anim {
+    // array in flash
+    const uint8_t * data;
+    // left top corner
+    uint8_t x;
+    uint8_t y;
+    // 1 = repeat forever, 0 = stop at last frame
+    uint8_t loop;
+    // next frame in data
+    const uint8_t * next;
+    // second frame, where loop continues behind wrap frame
+    const uint8_t * rewind;
+    // frames played in this pass
+    uint16_t frame;
+    // time of next frame
+    uint16_t deadline;
+  };
+
+  /**
+   * @desc    Start animation
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_anim *
+   * @param   uint16_t
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_Anim_Start (struct st7735 *, struct st7735_anim *, uint16_t);
+
+  /**
+   * @desc    Step animation
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_anim *
+   * @param   uint16_t
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_Anim_Tick (struct st7735 *, struct st7735_anim *, uint16_t);
+
+#endif
@@ -0,0 +1,152 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - images converted by asset tool
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       19.10.2026
+ * @file        st7735_asset.c
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735_asset.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Raw565 and palette rows are addressed directly, so clipped parts cost
+ *              nothing. RLE is decoded by st7735_rle.c from start, pixels out of clip are
+ *              dropped and decoding stops behind last visible row.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include "st7735_port.h"
+#include "st7735_asset.h"
+
+/**
+ * @desc    Visible part of raw565 pixels
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_burst *
+ * @param   const uint8_t * code - pixels
+ * @param   uint8_t w - width of asset
+ * @param   const struct window * - visible part relative to asset
+ *
+ * @return  void
+ */
+static void ST7735_Asset_Raw565 (struct st7735 * lcd, struct st7735_burst * burst, const uint8_t * code, uint8_t w, const struct window * win)
+{
+  const uint8_t * pixel;
+  uint8_t row = win->y0;
+  uint8_t col;
+
+  // loop through rows
+  do {
+    // first visible pixel of row
+    pixel = code + (((uint16_t) row * w + win->x0) << 1);
+    col = win->x0;
+    do {
+      ST7735_Burst_Push (lcd, burst, ST7735_Flash_Word (pixel));
+      pixel += 2;
+    } while (col++ != win->x1);
+  } while (row++ != win->y1);
+}
+
+/**
+ * @desc    Visible part of palette indices
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_burst *
+ * @param   const uint8_t * code - bits n colors indices
+ * @param   uint8_t w - width of asset
+ * @param   const struct window * - visible part relative to asset
+ *
+ * @return  void
+ */
+static void ST7735_Asset_Palette (struct st7735 * lcd, struct st7735_burst * burst, const uint8_t * code, uint8_t w, const struct window * win)
+{
+  uint8_t bits = pgm_read_byte (code);
+  uint8_t count = pgm_read_byte (code + 1);
+  const uint8_t * palette = code + 2;
+  // indices behind colors, 0 = 256 colors
+  const uint8_t * indices = palette + (count ? ((uint16_t) count << 1) : 512);
+  // bytes per row
+  uint8_t stride = ((uint16_t) w * bits + 7) >> 3;
+  // bits of byte used
+  uint8_t shift;
+  uint8_t byte;
+  const uint8_t * data;
+  uint16_t first;
+  uint8_t row = win->y0;
+  uint8_t col;
+
+  // bit of first visible index
+  first = (uint16_t) win->x0 * bits;
+  // loop through rows
+  do {
+    data = indices + (uint16_t) row * stride + (first >> 3);
+    byte = pgm_read_byte (data++) << (first & 7);
+    shift = first & 7;
+    col = win->x0;
+    do {
+      // next byte
+      if (shift == 8) {
+        byte = pgm_read_byte (data++);
+        shift = 0;
+      }
+      // index in top bits
+      ST7735_Burst_Push (lcd, burst, ST7735_Flash_Word (palette + ((byte >> (8 - bits)) << 1)));
+      byte <<= bits;
+      shift += bits;
+    } while (col++ != win->x1);
+  } while (row++ != win->y1);
+}
+
+/**
+ * @desc    Draw asset, clipped
+ *
+ * @param   struct st7735 *
+ * @param   const uint8_t * asset - array of tools/st7735_asset
+ * @param   uint8_t x - left
+ * @param   uint8_t y - top
+ *
+ * @return  uint8_t - ST7735_ERROR if nothing visible or unknown format
+ */
+uint8_t ST7735_Asset_Draw (struct st7735 * lcd, const uint8_t * asset, uint8_t x, uint8_t y)
+{
+  struct st7735_burst burst;
+  struct window win;
+  uint8_t format = pgm_read_byte (asset);
+  uint8_t w = pgm_read_byte (asset + 1);
+  uint8_t h = pgm_read_byte (asset + 2);
+
+  // unknown format or empty
+  if ((format > ST7735_ASSET_RLE) || (w == 0) || (h == 0)) {
+    return ST7735_ERROR;
+  }
+  // whole asset
+  win.x0 = x;
+  win.x1 = ((x + w - 1) > 0xFF) ? 0xFF : x + w - 1;
+  win.y0 = y;
+  win.y1 = ((y + h - 1) > 0xFF) ? 0xFF : y + h - 1;
+  // visible part
+  if ((ST7735_ClipWindow (lcd, &win) == ST7735_ERROR) ||
+      (ST7735_Burst_Begin (lcd, &burst, win.x0, win.x1, win.y0, win.y1) == ST7735_ERROR)) {
+    return ST7735_ERROR;
+  }
+  // relative to asset
+  win.x0 -= x;
+  win.x1 -= x;
+  win.y0 -= y;
+  win.y1 -= y;
+  // expand pixels
+  if (format == ST7735_ASSET_RAW565) {
+    ST7735_Asset_Raw565 (lcd, &burst, asset + ST7735_ASSET_HEADER, w, &win);
+  } else if (format == ST7735_ASSET_PALETTE) {
+    ST7735_Asset_Palette (lcd, &burst, asset + ST7735_ASSET_HEADER, w, &win);
+  } else {
+    ST7735_RLE_Burst (lcd, &burst, asset + ST7735_ASSET_HEADER, w, &win);
+  }
+  ST7735_Burst_End (lcd, &burst);
+  // success
+  return ST7735_SUCCESS;
+}
@@ -0,0 +1,59 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - images converted by asset tool
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       19.10.2026
+ * @file        st7735_asset.h
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735_rle.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Asset is PROGMEM array made from PNG by tools/st7735_asset, which picks the
+ *              smallest format for the image. Header is format w h, colors high byte first.
+ *
+ *                RAW565      w * h colors
+ *                PALETTE     bits n colors... indices...
+ *                              bits 1, 2, 4 or 8 per index (1 = 1bpp image), n colors
+ *                              (0 = 256), indices MSB first, rows padded to bytes
+ *                RLE         w * h pixels RLE coded (st7735_rle.h)
+ *
+ *              Every format is expanded on the fly into one window burst, so all cost the
+ *              same w * h * 2 bytes on SPI and differ only in flash and decoding.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include "st7735.h"
+#include "st7735_rle.h"
+
+#ifndef __ST7735_ASSET_H__
+#define __ST7735_ASSET_H__
+
+  // Asset format
+  // -----------------------------------
+  #define ST7735_ASSET_HEADER   3                 // format w h
+
+  /** @enum Asset formats */
+  enum st7735_asset_format {
+    ST7735_ASSET_RAW565 = 0x00,
+    ST7735_ASSET_PALETTE,
+    ST7735_ASSET_RLE
+  };
+
+  /**
+   * @desc    Draw asset
+   *
+   * @param   struct st7735 *
+   * @param   const uint8_t *
+   * @param   uint8_t
+   * @param   uint8_t
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_Asset_Draw (struct st7735 *, const uint8_t *, uint8_t, uint8_t);
+
+#endif
@@ -0,0 +1,202 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - GPIO bit-bang bus
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_bitbang.c
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735.h, st7735_bus.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       SPI mode 0, MSB first, on any two struct signal pins. Pins are given by
+ *              struct st7735_bitbang in lcd->bus_data.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include "st7735_port.h"
+#include "st7735.h"
+
+/**
+ * @desc    Init bus and control pins
+ *
+ * @param   struct st7735 *
+ *
+ * @return  void
+ */
+static void ST7735_BITBANG_Init (struct st7735 * lcd)
+{
+  struct st7735_bitbang * bus = lcd->bus_data;
+
+  // DDR
+  // --------------------------------------
+  SET_BIT (*(bus->sck->ddr), bus->sck->pin);
+  SET_BIT (*(bus->mosi->ddr), bus->mosi->pin);
+  SET_BIT (*(lcd->cs->ddr), lcd->cs->pin);
+  SET_BIT (*(lcd->bl->ddr), lcd->bl->pin);
+  SET_BIT (*(lcd->dc->ddr), lcd->dc->pin);
+  SET_BIT (*(lcd->rs->ddr), lcd->rs->pin);
+  // input with pull-up
+  if (bus->miso != NULL) {
+    CLR_BIT (*(bus->miso->ddr), bus->miso->pin);
+    SET_BIT (*(bus->miso->port), bus->miso->pin);
+  }
+  // PORT
+  // --------------------------------------
+  CLR_BIT (*(bus->sck->port), bus->sck->pin);   // Clock idle low
+  SET_BIT (*(lcd->cs->port), lcd->cs->pin);     // Chip Select H
+  SET_BIT (*(lcd->bl->port), lcd->bl->pin);     // BackLigt ON
+  SET_BIT (*(lcd->rs->port), lcd->rs->pin);     // Reset H
+}
+
+/**
+ * @desc    Chip select
+ *
+ * @param   struct st7735 *
+ * @param   uint8_t 1 = selected, 0 = released
+ *
+ * @return  void
+ */
+static void ST7735_BITBANG_Select (struct st7735 * lcd, uint8_t state)
+{
+  // chip select active low
+  if (state) {
+    CLR_BIT (*(lcd->cs->port), lcd->cs->pin);
+  } else {
+    SET_BIT (*(lcd->cs->port), lcd->cs->pin);
+  }
+}
+
+/**
+ * @desc    Data / Command
+ *
+ * @param   struct st7735 *
+ * @param   uint8_t ST7735_DATA / ST7735_COMMAND
+ *
+ * @return  void
+ */
+static void ST7735_BITBANG_Mode (struct st7735 * lcd, uint8_t mode)
+{
+  // data high, command low
+  if (mode) {
+    SET_BIT (*(lcd->dc->port), lcd->dc->pin);
+  } else {
+    CLR_BIT (*(lcd->dc->port), lcd->dc->pin);
+  }
+}
+
+/**
+ * @desc    Reset line
+ *
+ * @param   struct st7735 *
+ * @param   uint8_t level
+ *
+ * @return  void
+ */
+static void ST7735_BITBANG_ResetLine (struct st7735 * lcd, uint8_t level)
+{
+  // reset active low
+  if (level) {
+    SET_BIT (*(lcd->rs->port), lcd->rs->pin);
+  } else {
+    CLR_BIT (*(lcd->rs->port), lcd->rs->pin);
+  }
+}
+
+/**
+ * @desc    Bulk write
+ *
+ * @param   struct st7735 *
+ * @param   const uint8_t * buffer
+ * @param   uint16_t length
+ *
+ * @return  void
+ */
+static void ST7735_BITBANG_Write (struct st7735 * lcd, const uint8_t * buffer, uint16_t length)
+{
+  struct st7735_bitbang * bus = lcd->bus_data;
+  volatile uint8_t * sck = bus->sck->port;
+  volatile uint8_t * mosi = bus->mosi->port;
+  uint8_t sck_mask = 1 << bus->sck->pin;
+  uint8_t mosi_mask = 1 << bus->mosi->pin;
+  uint8_t data;
+  uint8_t mask;
+
+  // loop through buffer
+  while (length--) {
+    // load byte
+    data = *buffer++;
+    // MSB first
+    for (mask = 0x80; mask; mask >>= 1) {
+      // data bit
+      if (data & mask) {
+        *mosi |= mosi_mask;
+      } else {
+        *mosi &= ~mosi_mask;
+      }
+      // rising edge - display samples
+      *sck |= sck_mask;
+      // falling edge
+      *sck &= ~sck_mask;
+    }
+  }
+}
+
+/**
+ * @desc    Bulk read
+ *
+ * @param   struct st7735 *
+ * @param   uint8_t * buffer
+ * @param   uint16_t length
+ *
+ * @return  void
+ */
+static void ST7735_BITBANG_Read (struct st7735 * lcd, uint8_t * buffer, uint16_t length)
+{
+  struct st7735_bitbang * bus = lcd->bus_data;
+  volatile uint8_t * sck = bus->sck->port;
+  uint8_t sck_mask = 1 << bus->sck->pin;
+  uint8_t data;
+  uint8_t mask;
+
+  // no data in - reads as unwired line with pull-up
+  if (bus->miso == NULL) {
+    while (length--) {
+      *buffer++ = 0xFF;
+    }
+    return;
+  }
+  // loop through buffer
+  while (length--) {
+    data = 0;
+    // MSB first
+    for (mask = 0x80; mask; mask >>= 1) {
+      // rising edge - display drives bit on falling edge before
+      *sck |= sck_mask;
+      // sample
+      if (IS_BIT_SET (SIGNAL_PIN (bus->miso), bus->miso->pin)) {
+        data |= mask;
+      }
+      // falling edge
+      *sck &= ~sck_mask;
+    }
+    // store byte
+    *buffer++ = data;
+  }
+}
+
+/** @const GPIO bit-bang */
+const struct st7735_bus ST7735_BUS_BITBANG = {
+  .init   = ST7735_BITBANG_Init,
+  .select = ST7735_BITBANG_Select,
+  .mode   = ST7735_BITBANG_Mode,
+  .reset  = ST7735_BITBANG_ResetLine,
+  .write  = ST7735_BITBANG_Write,
+  .fill   = NULL,
+  .read   = ST7735_BITBANG_Read,
+  .pixels = NULL
+};
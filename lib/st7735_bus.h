@@ -0,0 +1,112 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - bus abstraction
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_bus.h
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Driver core talks to the display only through struct st7735_bus. Backends:
+ *                ST7735_BUS_SPI     - AVR hardware SPI (SPDR / SPCR), default on AVR
+ *                ST7735_BUS_BITBANG - GPIO bit-bang through struct signal pins
+ *                ST7735_BUS_SPIDEV  - Linux spidev + GPIO character device
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include <stdint.h>
+
+#ifndef __ST7735_BUS_H__
+#define __ST7735_BUS_H__
+
+  // Data / Command levels
+  // -----------------------------------
+  #define ST7735_COMMAND        0
+  #define ST7735_DATA           1
+
+  // Chip select states
+  // -----------------------------------
+  #define ST7735_SELECT_READ    2                 // keep selected across write and read
+
+  // Pixel array memory
+  // -----------------------------------
+  #define ST7735_SRAM           0                 // data memory
+  #define ST7735_FLASH          1                 // program memory, PROGMEM
+
+  // SPI clock steps, lcd->clock / lcd->clock_read
+  // -----------------------------------
+  #define ST7735_CLOCK_STEPS    7                 // step 0 fastest, each next halves clock
+
+  struct st7735;
+
+  /** @struct Bus operations */
+  struct st7735_bus {
+    // init bus and control pins
+    void (*init) (struct st7735 *);
+    // chip select; 1 = selected (line low), 0 = released (line high),
+    // ST7735_SELECT_READ = selected, line must not rise till released
+    void (*select) (struct st7735 *, uint8_t);
+    // data / command line; ST7735_DATA or ST7735_COMMAND
+    void (*mode) (struct st7735 *, uint8_t);
+    // reset line level
+    void (*reset) (struct st7735 *, uint8_t);
+    // bulk write of bytes
+    void (*write) (struct st7735 *, const uint8_t *, uint16_t);
+    // repeat 16 bits color count times; optional, NULL = core uses write
+    void (*fill) (struct st7735 *, uint16_t, uint16_t);
+    // bulk read of bytes; optional, NULL = no readback
+    void (*read) (struct st7735 *, uint8_t *, uint16_t);
+    // array of 16 bits colors, ST7735_SRAM or ST7735_FLASH; optional, NULL = core uses write
+    void (*pixels) (struct st7735 *, const uint16_t *, uint16_t, uint8_t);
+  };
+
+  /** @struct Bit-bang bus data; lcd->bus_data */
+  struct st7735_bitbang {
+    // Serial clock
+    struct signal * sck;
+    // Serial data out
+    struct signal * mosi;
+    // Serial data in; NULL = no readback, ReadWindow / Calibrate fail
+    struct signal * miso;
+  };
+
+  /** @struct Linux spidev bus data; lcd->bus_data */
+  struct st7735_spidev {
+    // spidev node, e.g. "/dev/spidev0.0"
+    const char * device;
+    // gpio character device for D/C, RST, BL lines, e.g. "/dev/gpiochip0"; NULL = no lines
+    const char * gpiochip;
+    // SPI clock in Hz at step 0, halved by each lcd->clock step
+    uint32_t speed;
+    // spidev file descriptor
+    int fd;
+    // requested gpio lines file descriptor
+    int lines;
+    // cached levels of gpio lines
+    uint8_t levels;
+    // chip select held after last transfer
+    uint8_t held;
+    // errno of first failed open or transfer, 0 = none; cleared by init or caller
+    int error;
+  };
+
+#if defined(__AVR__)
+  /** @const AVR hardware SPI */
+  extern const struct st7735_bus ST7735_BUS_SPI;
+#endif
+
+  /** @const GPIO bit-bang */
+  extern const struct st7735_bus ST7735_BUS_BITBANG;
+
+#if defined(__linux__)
+  /** @const Linux spidev */
+  extern const struct st7735_bus ST7735_BUS_SPIDEV;
+#endif
+
+#endif
@@ -0,0 +1,353 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - framebuffer
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_fb.c
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735_fb.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Flush walks scanlines, finds changed spans (gaps cheaper than new window are
+ *              bridged) and grows open windows downwards while next span fits inside them
+ *              with less waste than window setup costs. Window which is not continued on
+ *              next scanline is sent in one RAMWR burst.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include <string.h>
+#include "st7735_port.h"
+#include "st7735_fb.h"
+#include "st7735_stats.h"
+
+#if defined(ST7735_FRAMEBUFFER)
+
+/**
+ * @desc    Attach framebuffer
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_fb *
+ *
+ * @return  void
+ */
+void ST7735_FB_Init (struct st7735 * lcd, struct st7735_fb * fb)
+{
+  // clear frame
+  memset (fb->frame, 0, sizeof (fb->frame));
+  // panel content unknown - first flush sends everything
+  fb->valid = 0;
+  // attach
+  lcd->fb = fb;
+  // first pixel till window is set
+  fb->window.x0 = 0;
+  fb->window.x1 = 0;
+  fb->window.y0 = 0;
+  fb->window.y1 = 0;
+  fb->x = 0;
+  fb->y = 0;
+}
+
+/**
+ * @desc    Set window of framebuffer
+ *
+ * @param   struct st7735 *
+ * @param   uint8_t x - start position
+ * @param   uint8_t x - end position
+ * @param   uint8_t y - start position
+ * @param   uint8_t y - end position
+ *
+ * @return  void
+ */
+void ST7735_FB_Window (struct st7735 * lcd, uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1)
+{
+  struct st7735_fb * fb = lcd->fb;
+
+  // not attached yet
+  if (fb == NULL) {
+    return;
+  }
+  // window
+  fb->window.x0 = x0;
+  fb->window.x1 = x1;
+  fb->window.y0 = y0;
+  fb->window.y1 = y1;
+  // cursor to start
+  fb->x = x0;
+  fb->y = y0;
+}
+
+/**
+ * @desc    Write color pixels into window of framebuffer
+ *
+ * @param   struct st7735 *
+ * @param   uint16_t color
+ * @param   uint16_t count
+ *
+ * @return  void
+ */
+void ST7735_FB_Fill (struct st7735 * lcd, uint16_t color, uint16_t count)
+{
+  struct st7735_fb * fb = lcd->fb;
+
+  // counter
+  while (count--) {
+    // write pixel
+    fb->frame[fb->y * lcd->width + fb->x] = color;
+    // next column, wrap as controller does
+    if (++fb->x > fb->window.x1) {
+      // first column
+      fb->x = fb->window.x0;
+      // next row
+      if (++fb->y > fb->window.y1) {
+        fb->y = fb->window.y0;
+      }
+    }
+  }
+}
+
+/**
+ * @desc    Fill rectangle of framebuffer
+ *
+ * @param   struct st7735 *
+ * @param   struct window * - clipped window
+ * @param   uint16_t color
+ *
+ * @return  void
+ */
+void ST7735_FB_Rectangle (struct st7735 * lcd, const struct window * win, uint16_t color)
+{
+  uint16_t * line = &lcd->fb->frame[win->y0 * lcd->width];
+  uint16_t x;
+  uint16_t y;
+
+  // loop through rows
+  for (y = win->y0; y <= win->y1; y++) {
+    // loop through columns
+    for (x = win->x0; x <= win->x1; x++) {
+      line[x] = color;
+    }
+    // next row
+    line += lcd->width;
+  }
+}
+
+/**
+ * @desc    Send window of frame in one burst and update shadow
+ *
+ * @param   struct st7735 * - framebuffer detached
+ * @param   struct st7735_fb *
+ * @param   struct window *
+ *
+ * @return  void
+ */
+static void ST7735_FB_Send (struct st7735 * lcd, struct st7735_fb * fb, const struct window * win)
+{
+  uint8_t buffer[ST7735_FB_BUFFER];
+  uint16_t length = 0;
+  uint16_t offset;
+  uint16_t x;
+  uint16_t y;
+
+  // set window
+  ST7735_SetWindow (lcd, win->x0, win->x1, win->y0, win->y1);
+  // access to RAM
+  ST7735_CommandSend (lcd, RAMWR);
+  ST7735_STATS_ADD (data_bytes, (uint32_t) (win->x1 - win->x0 + 1) * (win->y1 - win->y0 + 1) << 1);
+  ST7735_STATS_ADD (cs_toggles, 1);
+  // chip enable - active low
+  lcd->bus->select (lcd, 1);
+  // data (active high)
+  lcd->bus->mode (lcd, ST7735_DATA);
+  // loop through rows
+  for (y = win->y0; y <= win->y1; y++) {
+    // row offset
+    offset = y * lcd->width;
+    // loop through columns
+    for (x = win->x0; x <= win->x1; x++) {
+      // high byte first
+      buffer[length++] = (uint8_t) (fb->frame[offset + x] >> 8);
+      buffer[length++] = (uint8_t) (fb->frame[offset + x]);
+      // buffer full
+      if (length == ST7735_FB_BUFFER) {
+        lcd->bus->write (lcd, buffer, length);
+        length = 0;
+      }
+    }
+    // panel holds this row now
+    memcpy (&fb->shadow[offset + win->x0], &fb->frame[offset + win->x0], (win->x1 - win->x0 + 1) << 1);
+  }
+  // rest of buffer
+  if (length) {
+    lcd->bus->write (lcd, buffer, length);
+  }
+  // chip disable - idle high
+  lcd->bus->select (lcd, 0);
+}
+
+/**
+ * @desc    Send changed spans of region to display, region clamped to framebuffer
+ *
+ * @param   struct st7735 *
+ * @param   struct window * region
+ *
+ * @return  uint16_t - number of windows sent
+ */
+uint16_t ST7735_FB_FlushWindow (struct st7735 * lcd, const struct window * region)
+{
+  struct st7735_fb * fb = lcd->fb;
+  struct window open[ST7735_FB_RECTS];
+  uint8_t extended[ST7735_FB_RECTS];
+  struct window screen = { .x0 = 0, .x1 = lcd->width - 1, .y0 = 0, .y1 = lcd->height - 1 };
+  struct window area = *region;
+  uint16_t windows = 0;
+  uint16_t * frame;
+  uint16_t * shadow;
+  uint16_t gap;
+  uint16_t a, b;
+  uint16_t x, y;
+  uint8_t count = 0;
+  uint8_t i;
+
+  // detach - primitives below go to bus
+  lcd->fb = NULL;
+
+  // panel content unknown - send whole screen
+  if (!fb->valid) {
+    // one window
+    ST7735_FB_Send (lcd, fb, &screen);
+    // shadow is valid
+    fb->valid = 1;
+    // attach again
+    lcd->fb = fb;
+    // one window sent
+    return 1;
+  }
+
+  // region starts outside framebuffer
+  if ((area.x0 > area.x1) || (area.y0 > area.y1) || (area.x0 >= lcd->width) || (area.y0 >= lcd->height)) {
+    // attach again
+    lcd->fb = fb;
+    // nothing sent
+    return 0;
+  }
+  // clamp to framebuffer
+  if (area.x1 >= lcd->width) {
+    area.x1 = lcd->width - 1;
+  }
+  if (area.y1 >= lcd->height) {
+    area.y1 = lcd->height - 1;
+  }
+
+  // loop through scanlines
+  for (y = area.y0; y <= area.y1; y++) {
+    // scanline
+    frame = &fb->frame[y * lcd->width];
+    shadow = &fb->shadow[y * lcd->width];
+    // no window continued yet
+    memset (extended, 0, sizeof (extended));
+
+    // loop through changed spans
+    x = area.x0;
+    while (x <= area.x1) {
+      // unchanged pixel
+      if (frame[x] == shadow[x]) {
+        x++;
+        continue;
+      }
+      // span start
+      a = b = x;
+      gap = 0;
+      // extend span over gaps cheaper than new window
+      for (x = a + 1; x <= area.x1; x++) {
+        if (frame[x] != shadow[x]) {
+          b = x;
+          gap = 0;
+        } else if ((++gap << 1) > ST7735_FB_OVERHEAD) {
+          break;
+        }
+      }
+      // continue after span
+      x = b + 1;
+
+      // find open window to continue
+      for (i = 0; i < count; i++) {
+        // span must lie inside window
+        if ((a < open[i].x0) || (b > open[i].x1)) {
+          continue;
+        }
+        // already continued on this scanline - span is covered
+        if (extended[i]) {
+          break;
+        }
+        // waste cheaper than new window
+        if ((((open[i].x1 - open[i].x0) - (b - a)) << 1) <= ST7735_FB_OVERHEAD) {
+          open[i].y1 = y;
+          extended[i] = 1;
+          break;
+        }
+      }
+      // span handled
+      if (i < count) {
+        continue;
+      }
+      // no free slot - send oldest window
+      if (count == ST7735_FB_RECTS) {
+        ST7735_FB_Send (lcd, fb, &open[0]);
+        windows++;
+        memmove (&open[0], &open[1], (ST7735_FB_RECTS - 1) * sizeof (struct window));
+        memmove (&extended[0], &extended[1], ST7735_FB_RECTS - 1);
+        count--;
+      }
+      // open new window
+      open[count].x0 = a;
+      open[count].x1 = b;
+      open[count].y0 = y;
+      open[count].y1 = y;
+      extended[count++] = 1;
+    }
+
+    // send windows not continued on this scanline
+    for (i = 0; i < count; ) {
+      if (extended[i]) {
+        i++;
+        continue;
+      }
+      ST7735_FB_Send (lcd, fb, &open[i]);
+      windows++;
+      open[i] = open[--count];
+      extended[i] = extended[count];
+    }
+  }
+  // send rest of windows
+  for (i = 0; i < count; i++) {
+    ST7735_FB_Send (lcd, fb, &open[i]);
+    windows++;
+  }
+
+  // attach again
+  lcd->fb = fb;
+  // number of windows
+  return windows;
+}
+
+/**
+ * @desc    Send changed spans to display
+ *
+ * @param   struct st7735 *
+ *
+ * @return  uint16_t - number of windows sent
+ */
+uint16_t ST7735_FB_Flush (struct st7735 * lcd)
+{
+  struct window screen = { .x0 = 0, .x1 = lcd->width - 1, .y0 = 0, .y1 = lcd->height - 1 };
+
+  // whole screen
+  return ST7735_FB_FlushWindow (lcd, &screen);
+}
+
+#endif
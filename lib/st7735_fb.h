@@ -0,0 +1,118 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - framebuffer
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_fb.h
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Compiled only with ST7735_FRAMEBUFFER (needs 2 x CACHE_SIZE_MEM pixels of RAM).
+ *              When lcd->fb is set, all primitives render into memory and nothing is sent.
+ *              ST7735_FB_Flush compares frame with last flushed frame per scanline and sends
+ *              only changed spans, merged into as few windows as possible.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include "st7735.h"
+
+#ifndef __ST7735_FB_H__
+#define __ST7735_FB_H__
+
+#if defined(ST7735_FRAMEBUFFER)
+
+  // Flush settings
+  // -----------------------------------
+  #define ST7735_FB_OVERHEAD    11                // bytes of CASET + RASET + RAMWR window setup
+  #define ST7735_FB_RECTS       16                // max open windows during flush
+  #define ST7735_FB_BUFFER      4096              // bytes handed to bus at once
+
+  /** @struct Framebuffer */
+  struct st7735_fb {
+    // frame being drawn
+    uint16_t frame[CACHE_SIZE_MEM];
+    // last flushed frame
+    uint16_t shadow[CACHE_SIZE_MEM];
+    // window set by ST7735_SetWindow
+    struct window window;
+    // write cursor x inside window
+    uint8_t x;
+    // write cursor y inside window
+    uint8_t y;
+    // shadow holds panel content
+    uint8_t valid;
+  };
+
+  /**
+   * @desc    Attach framebuffer
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_fb *
+   *
+   * @return  void
+   */
+  void ST7735_FB_Init (struct st7735 *, struct st7735_fb *);
+
+  /**
+   * @desc    Set window of framebuffer
+   *
+   * @param   struct st7735 *
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   uint8_t
+   *
+   * @return  void
+   */
+  void ST7735_FB_Window (struct st7735 *, uint8_t, uint8_t, uint8_t, uint8_t);
+
+  /**
+   * @desc    Write color pixels into window of framebuffer
+   *
+   * @param   struct st7735 *
+   * @param   uint16_t
+   * @param   uint16_t
+   *
+   * @return  void
+   */
+  void ST7735_FB_Fill (struct st7735 *, uint16_t, uint16_t);
+
+  /**
+   * @desc    Fill rectangle of framebuffer
+   *
+   * @param   struct st7735 *
+   * @param   struct window *
+   * @param   uint16_t
+   *
+   * @return  void
+   */
+  void ST7735_FB_Rectangle (struct st7735 *, const struct window *, uint16_t);
+
+  /**
+   * @desc    Send changed spans to display
+   *
+   * @param   struct st7735 *
+   *
+   * @return  uint16_t - number of windows sent
+   */
+  uint16_t ST7735_FB_Flush (struct st7735 *);
+
+  /**
+   * @desc    Send changed spans of region to display, region clamped to framebuffer
+   *
+   * @param   struct st7735 *
+   * @param   struct window *
+   *
+   * @return  uint16_t - number of windows sent
+   */
+  uint16_t ST7735_FB_FlushWindow (struct st7735 *, const struct window *);
+
+#endif
+
+#endif
@@ -0,0 +1,211 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - gradient and pattern fills
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_fill.c
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735_fill.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Steps are truncated toward zero, so accumulators never pass end color and
+ *              channels need no saturation, neither with dither threshold (< 1.0) added.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include "st7735_port.h"
+#include "st7735_fill.h"
+
+/** @array Ordered dither thresholds 4x4, 8.8 fraction */
+static const uint8_t BAYER[4][4] PROGMEM = {
+  {   8, 136,  40, 168 },
+  { 200,  72, 232, 104 },
+  {  56, 184,  24, 152 },
+  { 248, 120, 216,  88 }
+};
+
+/** @struct Color channels in 8.8 fixed point */
+struct st7735_rgb {
+  // red 5 bits
+  int16_t r;
+  // green 6 bits
+  int16_t g;
+  // blue 5 bits
+  int16_t b;
+};
+
+/**
+ * @desc    Color from accumulators
+ *
+ * @param   struct st7735_rgb *
+ * @param   uint8_t threshold - fraction added before truncation
+ *
+ * @return  uint16_t
+ */
+static inline uint16_t ST7735_Fill_Color (const struct st7735_rgb * acc, uint8_t threshold)
+{
+  return ((uint16_t) ((acc->r + threshold) >> 8) << 11) |
+         ((uint16_t) ((acc->g + threshold) >> 8) << 5) |
+         ((uint16_t) ((acc->b + threshold) >> 8));
+}
+
+/**
+ * @desc    Step accumulators
+ *
+ * @param   struct st7735_rgb *
+ * @param   struct st7735_rgb * step
+ *
+ * @return  void
+ */
+static inline void ST7735_Fill_Step (struct st7735_rgb * acc, const struct st7735_rgb * step)
+{
+  acc->r += step->r;
+  acc->g += step->g;
+  acc->b += step->b;
+}
+
+/**
+ * @desc    Fill rectangle with linear gradient
+ *
+ * @param   struct st7735 *
+ * @param   uint8_t x - start position
+ * @param   uint8_t x - end position
+ * @param   uint8_t y - start position
+ * @param   uint8_t y - end position
+ * @param   uint16_t color - at start
+ * @param   uint16_t color - at end
+ * @param   uint8_t enum Gradient
+ *
+ * @return  void
+ */
+void ST7735_FillGradient (struct st7735 * lcd, uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1, uint16_t from, uint16_t to, uint8_t mode)
+{
+  struct window win = { .x0 = x0, .x1 = x1, .y0 = y0, .y1 = y1 };
+  struct st7735_burst burst;
+  struct st7735_rgb start;
+  struct st7735_rgb step;
+  struct st7735_rgb acc;
+  uint8_t vertical = mode & GRADIENT_Y;
+  uint8_t steps = vertical ? (y1 - y0) : (x1 - x0);
+  uint8_t skip;
+  uint8_t row[4];
+  uint16_t color;
+  uint8_t x, y;
+
+  // cull before any command is sent
+  if ((x0 > x1) || (y0 > y1) || (ST7735_ClipWindow (lcd, &win) == ST7735_ERROR)) {
+    return;
+  }
+  // channels at start
+  start.r = (from >> 11) << 8;
+  start.g = ((from >> 5) & 0x3F) << 8;
+  start.b = (from & 0x1F) << 8;
+  // step per pixel - only divisions of fill
+  step.r = steps ? (int16_t) ((((int16_t) (to >> 11) << 8) - start.r) / steps) : 0;
+  step.g = steps ? (int16_t) ((((int16_t) ((to >> 5) & 0x3F) << 8) - start.g) / steps) : 0;
+  step.b = steps ? (int16_t) ((((int16_t) (to & 0x1F) << 8) - start.b) / steps) : 0;
+  // clipped away from start
+  skip = vertical ? (win.y0 - y0) : (win.x0 - x0);
+  start.r += (int32_t) step.r * skip;
+  start.g += (int32_t) step.g * skip;
+  start.b += (int32_t) step.b * skip;
+  acc = start;
+
+  ST7735_Burst_Begin (lcd, &burst, win.x0, win.x1, win.y0, win.y1);
+  // loop through rows
+  for (y = win.y0; ; y++) {
+    // thresholds of row, rounding without dither
+    if (mode & GRADIENT_DITHER) {
+      memcpy_P (row, BAYER[y & 3], 4);
+    } else {
+      row[0] = row[1] = row[2] = row[3] = 0x80;
+    }
+    // horizontal - every row from start
+    if (!vertical) {
+      acc = start;
+    }
+    // vertical rounded - one color per row
+    color = ST7735_Fill_Color (&acc, 0x80);
+    // loop through columns
+    for (x = win.x0; ; x++) {
+      // color of pixel
+      if (!vertical || (mode & GRADIENT_DITHER)) {
+        color = ST7735_Fill_Color (&acc, row[x & 3]);
+      }
+      ST7735_Burst_Push (lcd, &burst, color);
+      // horizontal step
+      if (!vertical) {
+        ST7735_Fill_Step (&acc, &step);
+      }
+      // end of row
+      if (x == win.x1) {
+        break;
+      }
+    }
+    // vertical step
+    if (vertical) {
+      ST7735_Fill_Step (&acc, &step);
+    }
+    // end of window
+    if (y == win.y1) {
+      break;
+    }
+  }
+  ST7735_Burst_End (lcd, &burst);
+}
+
+/**
+ * @desc    Fill rectangle with 8x8 pattern
+ *
+ * @param   struct st7735 *
+ * @param   uint8_t x - start position
+ * @param   uint8_t x - end position
+ * @param   uint8_t y - start position
+ * @param   uint8_t y - end position
+ * @param   const uint8_t * pattern - 8 rows in flash, MSB = left
+ * @param   uint16_t color - set bits
+ * @param   uint16_t color - clear bits
+ *
+ * @return  void
+ */
+void ST7735_FillPattern (struct st7735 * lcd, uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1, const uint8_t * pattern, uint16_t fg, uint16_t bg)
+{
+  struct window win = { .x0 = x0, .x1 = x1, .y0 = y0, .y1 = y1 };
+  struct st7735_burst burst;
+  uint8_t bits;
+  uint8_t mask;
+  uint8_t x, y;
+
+  // cull before any command is sent
+  if ((x0 > x1) || (y0 > y1) || (ST7735_ClipWindow (lcd, &win) == ST7735_ERROR)) {
+    return;
+  }
+  ST7735_Burst_Begin (lcd, &burst, win.x0, win.x1, win.y0, win.y1);
+  // loop through rows
+  for (y = win.y0; ; y++) {
+    // read from ROM memory
+    bits = pgm_read_byte (&pattern[y & 7]);
+    // bit of first column
+    mask = 0x80 >> (win.x0 & 7);
+    // loop through columns
+    for (x = win.x0; ; x++) {
+      ST7735_Burst_Push (lcd, &burst, (bits & mask) ? fg : bg);
+      // next bit, wrap
+      mask = (mask == 0x01) ? 0x80 : (mask >> 1);
+      // end of row
+      if (x == win.x1) {
+        break;
+      }
+    }
+    // end of window
+    if (y == win.y1) {
+      break;
+    }
+  }
+  ST7735_Burst_End (lcd, &burst);
+}
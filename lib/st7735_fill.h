@@ -0,0 +1,70 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - gradient and pattern fills
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_fill.h
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Colors are computed while streaming into one window, so fill costs the same
+ *              wire time as ST7735_DrawRectangle. Gradient keeps channels in 8.8 fixed point
+ *              accumulators (additions only per pixel), optionally ordered 4x4 dither.
+ *              Pattern is 8x8 bits in flash anchored to screen, so neighbouring fills join.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include "st7735.h"
+
+#ifndef __ST7735_FILL_H__
+#define __ST7735_FILL_H__
+
+  /** @enum Gradient - direction optionally ored with GRADIENT_DITHER */
+  enum Gradient {
+    // from left to right
+    GRADIENT_X = 0x00,
+    // from top to bottom
+    GRADIENT_Y = 0x01,
+    // ordered dither instead of rounding, no banding
+    GRADIENT_DITHER = 0x02
+  };
+
+  /**
+   * @desc    Fill rectangle with linear gradient
+   *
+   * @param   struct st7735 *
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   uint16_t
+   * @param   uint16_t
+   * @param   uint8_t
+   *
+   * @return  void
+   */
+  void ST7735_FillGradient (struct st7735 *, uint8_t, uint8_t, uint8_t, uint8_t, uint16_t, uint16_t, uint8_t);
+
+  /**
+   * @desc    Fill rectangle with 8x8 pattern
+   *
+   * @param   struct st7735 *
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   const uint8_t *
+   * @param   uint16_t
+   * @param   uint16_t
+   *
+   * @return  void
+   */
+  void ST7735_FillPattern (struct st7735 *, uint8_t, uint8_t, uint8_t, uint8_t, const uint8_t *, uint16_t, uint16_t);
+
+#endif
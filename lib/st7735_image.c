@@ -0,0 +1,409 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - images from block storage
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_image.c
+ * @version     2.0
+ * @tested      Linux (make test)
+ *
+ * @depend      st7735_image.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Pixels are converted from block buffer straight into burst, there is no row
+ *              buffer. Raw565 rows already in wire order are handed from block buffer to bus
+ *              as they are. Bottom-up BMP rows are sent in file order, each row in own
+ *              window (11 command bytes per row). Inverted row order of MADCTL is not used,
+ *              controller mirrors rows around its whole GRAM (128, 130, 132 or 160, 162
+ *              rows by variant), not around visible part.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#if !defined(__AVR__)
+#include <stdio.h>
+#endif
+#include "st7735_port.h"
+#include "st7735_image.h"
+#include "st7735_stats.h"
+
+// Pixel formats
+// -----------------------------------
+#define ST7735_IMAGE_RAW565     0                 // 565 high byte first
+#define ST7735_IMAGE_BMP565     1                 // 565 low byte first
+#define ST7735_IMAGE_BMP555     2                 // x555 low byte first
+#define ST7735_IMAGE_BGR888     3                 // blue, green, red
+
+/** @struct Sequential reader of storage */
+struct st7735_reader {
+  // storage
+  struct st7735_storage * storage;
+  // block number of position
+  uint32_t block;
+  // position in block
+  uint16_t position;
+  // block is in buffer
+  uint8_t loaded;
+  // read failed
+  uint8_t error;
+};
+
+/**
+ * @desc    Move reader to byte offset
+ *
+ * @param   struct st7735_reader *
+ * @param   uint32_t offset
+ *
+ * @return  void
+ */
+static void ST7735_Reader_Seek (struct st7735_reader * reader, uint32_t offset)
+{
+  uint32_t block = offset / reader->storage->size;
+
+  // other block
+  if (block != reader->block) {
+    reader->block = block;
+    reader->loaded = 0;
+  }
+  reader->position = offset % reader->storage->size;
+}
+
+/**
+ * @desc    Skip bytes, blocks skipped whole are not read
+ *
+ * @param   struct st7735_reader *
+ * @param   uint32_t count
+ *
+ * @return  void
+ */
+static void ST7735_Reader_Skip (struct st7735_reader * reader, uint32_t count)
+{
+  ST7735_Reader_Seek (reader, (uint32_t) reader->block * reader->storage->size + reader->position + count);
+}
+
+/**
+ * @desc    Bytes available in buffer at position, block read when needed
+ *
+ * @param   struct st7735_reader *
+ *
+ * @return  uint16_t
+ */
+static uint16_t ST7735_Reader_Fill (struct st7735_reader * reader)
+{
+  // end of block
+  if (reader->position == reader->storage->size) {
+    reader->block++;
+    reader->position = 0;
+    reader->loaded = 0;
+  }
+  // read block
+  if (!reader->loaded) {
+    if (reader->storage->read (reader->storage, reader->block) == ST7735_ERROR) {
+      reader->error = 1;
+    }
+    reader->loaded = 1;
+  }
+  // rest of block
+  return reader->storage->size - reader->position;
+}
+
+/**
+ * @desc    Next byte
+ *
+ * @param   struct st7735_reader *
+ *
+ * @return  uint8_t
+ */
+static inline uint8_t ST7735_Reader_Byte (struct st7735_reader * reader)
+{
+  // next block
+  if ((reader->position == reader->storage->size) || !reader->loaded) {
+    ST7735_Reader_Fill (reader);
+  }
+  return reader->storage->buffer[reader->position++];
+}
+
+/**
+ * @desc    Next pixel converted to 565
+ *
+ * @param   struct st7735_reader *
+ * @param   uint8_t format
+ *
+ * @return  uint16_t
+ */
+static inline uint16_t ST7735_Reader_Pixel (struct st7735_reader * reader, uint8_t format)
+{
+  uint16_t value;
+  uint8_t b, g, r;
+
+  // 3 bytes
+  if (format == ST7735_IMAGE_BGR888) {
+    b = ST7735_Reader_Byte (reader);
+    g = ST7735_Reader_Byte (reader);
+    r = ST7735_Reader_Byte (reader);
+    return ((uint16_t) (r & 0xF8) << 8) | ((uint16_t) (g & 0xFC) << 3) | (b >> 3);
+  }
+  // 2 bytes
+  value = ST7735_Reader_Byte (reader);
+  // high byte first
+  if (format == ST7735_IMAGE_RAW565) {
+    return (value << 8) | ST7735_Reader_Byte (reader);
+  }
+  // low byte first
+  value |= (uint16_t) ST7735_Reader_Byte (reader) << 8;
+  // green 5 bits to 6 bits
+  if (format == ST7735_IMAGE_BMP555) {
+    value = ((value & 0x7FE0) << 1) | ((value >> 4) & 0x20) | (value & 0x1F);
+  }
+  return value;
+}
+
+/**
+ * @desc    Send bytes of block buffer to bus as they are
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_reader *
+ * @param   uint16_t count
+ *
+ * @return  void
+ */
+static void ST7735_Reader_Copy (struct st7735 * lcd, struct st7735_reader * reader, uint16_t count)
+{
+  uint16_t length;
+
+  // loop through blocks
+  while (count && !reader->error) {
+    // bytes in buffer
+    length = ST7735_Reader_Fill (reader);
+    length = (length > count) ? count : length;
+    // no copy
+    ST7735_STATS_ADD (data_bytes, length);
+    lcd->bus->write (lcd, reader->storage->buffer + reader->position, length);
+    reader->position += length;
+    count -= length;
+  }
+}
+
+/**
+ * @desc    Stream pixels of image into window
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_reader * - at first pixel
+ * @param   uint8_t x - left top corner
+ * @param   uint8_t y - left top corner
+ * @param   uint16_t width
+ * @param   uint16_t height
+ * @param   uint8_t format
+ * @param   uint8_t bottom up rows
+ * @param   uint8_t padding bytes after row
+ *
+ * @return  uint8_t
+ */
+static uint8_t ST7735_Image_Stream (struct st7735 * lcd, struct st7735_reader * reader, uint8_t x, uint8_t y, uint16_t width, uint16_t height, uint8_t format, uint8_t bottom, uint8_t padding)
+{
+  struct st7735_burst burst;
+  struct window win;
+  uint8_t bytes = (format == ST7735_IMAGE_BGR888) ? 3 : 2;
+  uint16_t right = x + width - 1;
+  uint16_t lower = y + height - 1;
+  uint8_t copy = (format == ST7735_IMAGE_RAW565);
+  // rows from bottom up - window per row
+  uint8_t per_row = bottom;
+  uint16_t i, j;
+  uint16_t row;
+
+  // empty image
+  if ((width == 0) || (height == 0)) {
+    return ST7735_SUCCESS;
+  }
+  // whole image
+  win.x0 = x;
+  win.x1 = (right > 0xFF) ? 0xFF : right;
+  win.y0 = y;
+  win.y1 = (lower > 0xFF) ? 0xFF : lower;
+  // nothing visible
+  if (ST7735_ClipWindow (lcd, &win) == ST7735_ERROR) {
+    return ST7735_SUCCESS;
+  }
+#if defined(ST7735_FRAMEBUFFER)
+  // framebuffer - pixels go through burst
+  if (lcd->fb != NULL) {
+    copy = 0;
+  }
+#endif
+  // one window for top-down rows
+  if (!per_row) {
+    ST7735_Burst_Begin (lcd, &burst, win.x0, win.x1, win.y0, win.y1);
+  }
+  // loop through rows in storage order
+  for (i = 0; (i < height) && !reader->error; i++) {
+    row = bottom ? (lower - i) : (y + i);
+    // row out of window
+    if ((row < win.y0) || (row > win.y1)) {
+      ST7735_Reader_Skip (reader, (uint32_t) width * bytes + padding);
+      continue;
+    }
+    // own window
+    if (per_row) {
+      ST7735_Burst_Begin (lcd, &burst, win.x0, win.x1, row, row);
+    }
+    // columns left of window
+    ST7735_Reader_Skip (reader, (uint16_t) (win.x0 - x) * bytes);
+    // wire order, no conversion
+    if (copy) {
+      ST7735_Reader_Copy (lcd, reader, (uint16_t) (win.x1 - win.x0 + 1) << 1);
+    } else {
+      // loop through visible columns
+      for (j = win.x0; j <= win.x1; j++) {
+        ST7735_Burst_Push (lcd, &burst, ST7735_Reader_Pixel (reader, format));
+      }
+    }
+    // columns right of window and padding
+    ST7735_Reader_Skip (reader, (uint16_t) (right - win.x1) * bytes + padding);
+    if (per_row) {
+      ST7735_Burst_End (lcd, &burst);
+    }
+  }
+  // window done
+  if (!per_row) {
+    ST7735_Burst_End (lcd, &burst);
+  }
+  // result
+  return reader->error ? ST7735_ERROR : ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Draw raw565 image
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_storage *
+ * @param   uint32_t offset - first byte of image in storage
+ * @param   uint8_t x - left top corner
+ * @param   uint8_t y - left top corner
+ * @param   uint16_t width
+ * @param   uint16_t height
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7735_Image_Raw565 (struct st7735 * lcd, struct st7735_storage * storage, uint32_t offset, uint8_t x, uint8_t y, uint16_t width, uint16_t height)
+{
+  struct st7735_reader reader = { .storage = storage, .block = 0, .position = 0, .loaded = 0, .error = 0 };
+
+  ST7735_Reader_Seek (&reader, offset);
+  return ST7735_Image_Stream (lcd, &reader, x, y, width, height, ST7735_IMAGE_RAW565, 0, 0);
+}
+
+/**
+ * @desc    Little endian value of header
+ *
+ * @param   uint8_t * bytes
+ * @param   uint8_t count
+ *
+ * @return  uint32_t
+ */
+static uint32_t ST7735_Image_Value (const uint8_t * bytes, uint8_t count)
+{
+  uint32_t value = 0;
+
+  // from most significant
+  while (count--) {
+    value = (value << 8) | bytes[count];
+  }
+  return value;
+}
+
+/**
+ * @desc    Draw BMP image
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_storage *
+ * @param   uint32_t offset - first byte of file in storage
+ * @param   uint8_t x - left top corner
+ * @param   uint8_t y - left top corner
+ *
+ * @return  uint8_t - ST7735_ERROR on read failure or unsupported file
+ */
+uint8_t ST7735_Image_BMP (struct st7735 * lcd, struct st7735_storage * storage, uint32_t offset, uint8_t x, uint8_t y)
+{
+  struct st7735_reader reader = { .storage = storage, .block = 0, .position = 0, .loaded = 0, .error = 0 };
+  // file header, info header, red mask
+  uint8_t header[58];
+  int32_t width;
+  int32_t height;
+  uint16_t bits;
+  uint32_t compression;
+  uint8_t format;
+  uint8_t padding;
+  uint8_t i;
+
+  ST7735_Reader_Seek (&reader, offset);
+  // loop through header
+  for (i = 0; i < sizeof (header); i++) {
+    header[i] = ST7735_Reader_Byte (&reader);
+  }
+  // not BMP or unreadable
+  if (reader.error || (header[0] != 'B') || (header[1] != 'M') || (ST7735_Image_Value (&header[14], 4) < 40)) {
+    return ST7735_ERROR;
+  }
+  width = (int32_t) ST7735_Image_Value (&header[18], 4);
+  height = (int32_t) ST7735_Image_Value (&header[22], 4);
+  bits = ST7735_Image_Value (&header[28], 2);
+  compression = ST7735_Image_Value (&header[30], 4);
+  // 24 bits uncompressed
+  if ((bits == 24) && (compression == 0)) {
+    format = ST7735_IMAGE_BGR888;
+  // 16 bits 555
+  } else if ((bits == 16) && (compression == 0)) {
+    format = ST7735_IMAGE_BMP555;
+  // 16 bits with masks, red mask says which
+  } else if ((bits == 16) && (compression == 3)) {
+    format = (ST7735_Image_Value (&header[54], 4) == 0xF800) ? ST7735_IMAGE_BMP565 : ST7735_IMAGE_BMP555;
+  } else {
+    return ST7735_ERROR;
+  }
+  // beyond any screen
+  if ((width <= 0) || (width > 0xFFFF) || (height == 0) || (height > 0xFFFF) || (height < -0xFFFF)) {
+    return ST7735_ERROR;
+  }
+  // rows aligned to 4 bytes
+  padding = (4 - ((width * (bits >> 3)) & 3)) & 3;
+  // pixel data
+  ST7735_Reader_Seek (&reader, offset + ST7735_Image_Value (&header[10], 4));
+  // negative height = top-down
+  if (height < 0) {
+    return ST7735_Image_Stream (lcd, &reader, x, y, width, -height, format, 0, padding);
+  }
+  return ST7735_Image_Stream (lcd, &reader, x, y, width, height, format, 1, padding);
+}
+
+#if !defined(__AVR__)
+/**
+ * @desc    Read block of file, context is FILE *
+ *          bytes behind end of file are zero
+ *
+ * @param   struct st7735_storage *
+ * @param   uint32_t block
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7735_Image_FileRead (struct st7735_storage * storage, uint32_t block)
+{
+  FILE * file = storage->context;
+  size_t count;
+
+  // position of block
+  if (fseek (file, (long) block * storage->size, SEEK_SET) != 0) {
+    return ST7735_ERROR;
+  }
+  count = fread (storage->buffer, 1, storage->size, file);
+  // end of file
+  if (count == 0) {
+    return ST7735_ERROR;
+  }
+  // rest of block
+  memset (storage->buffer + count, 0, storage->size - count);
+  return ST7735_SUCCESS;
+}
+#endif
@@ -0,0 +1,81 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - images from block storage
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_image.h
+ * @version     2.0
+ * @tested      Linux (make test)
+ *
+ * @depend      st7735.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Images on SD card or SPI flash are streamed block by block through read
+ *              callback into one RAMWR window; only one block buffer is needed (512 B for SD).
+ *              Raw565 is width x height pixels high byte first, top row first. BMP may be
+ *              24 bits BGR888, 16 bits 565 (BI_BITFIELDS) or 555, bottom-up or top-down.
+ *              Parts out of screen or clip are skipped without reading their blocks.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include "st7735.h"
+
+#ifndef __ST7735_IMAGE_H__
+#define __ST7735_IMAGE_H__
+
+  /** @struct Block storage */
+  struct st7735_storage {
+    // read block number into buffer; ST7735_SUCCESS / ST7735_ERROR
+    uint8_t (*read) (struct st7735_storage *, uint32_t);
+    // context of callback, e.g. card or FILE *
+    void * context;
+    // block size in bytes
+    uint16_t size;
+    // block buffer of size bytes
+    uint8_t * buffer;
+  };
+
+  /**
+   * @desc    Draw raw565 image
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_storage *
+   * @param   uint32_t
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   uint16_t
+   * @param   uint16_t
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_Image_Raw565 (struct st7735 *, struct st7735_storage *, uint32_t, uint8_t, uint8_t, uint16_t, uint16_t);
+
+  /**
+   * @desc    Draw BMP image
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_storage *
+   * @param   uint32_t
+   * @param   uint8_t
+   * @param   uint8_t
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_Image_BMP (struct st7735 *, struct st7735_storage *, uint32_t, uint8_t, uint8_t);
+
+#if !defined(__AVR__)
+  /**
+   * @desc    Read block of file, context is FILE *
+   *
+   * @param   struct st7735_storage *
+   * @param   uint32_t
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_Image_FileRead (struct st7735_storage *, uint32_t);
+#endif
+
+#endif
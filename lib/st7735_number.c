@@ -0,0 +1,322 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - number fields
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_number.c
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735_number.h, font.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Decimal digits are found by subtracting powers of ten, AVR has no divide
+ *              instruction and 32 bits division from libgcc costs hundreds of cycles per
+ *              digit. Value which does not fit field is shown as dashes.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include "st7735_port.h"
+#include "st7735_number.h"
+#include "font.h"
+
+/** @array Powers of ten, 10^9 - 10^1 */
+static const uint32_t POWERS[9] PROGMEM = {
+  1000000000, 100000000, 10000000, 1000000, 100000, 10000, 1000, 100, 10
+};
+
+/**
+ * @desc    Decimal digits of value
+ *
+ * @param   char * digits - at least 10 characters
+ * @param   uint32_t value
+ * @param   uint8_t minimum - number of digits, leading zeros kept
+ *
+ * @return  uint8_t - number of digits
+ */
+uint8_t ST7735_Number_Decimal (char * digits, uint32_t value, uint8_t minimum)
+{
+  uint32_t power;
+  uint8_t count = 0;
+  uint8_t i;
+  char digit;
+
+  // loop through powers
+  for (i = 0; i < 9; i++) {
+    // read from ROM memory
+    power = pgm_read_dword (&POWERS[i]);
+    digit = '0';
+    // at most 9 subtractions
+    while (value >= power) {
+      value -= power;
+      digit++;
+    }
+    // leading zeros left out
+    if (count || (digit != '0') || ((10 - i) <= minimum)) {
+      digits[count++] = digit;
+    }
+  }
+  // units
+  digits[count++] = '0' + (uint8_t) value;
+  // number of digits
+  return count;
+}
+
+/**
+ * @desc    Row of glyph
+ *
+ * @param   uint8_t large
+ * @param   char character
+ * @param   uint8_t row
+ *
+ * @return  uint8_t - bits, MSB left
+ */
+static uint8_t ST7735_Number_Row (uint8_t large, char character, uint8_t row)
+{
+  uint8_t bits = 0;
+  uint8_t index;
+  uint8_t col;
+
+  // large digits
+  if (large) {
+    // index in DIGITS
+    if ((character >= '0') && (character <= '9')) {
+      index = character - '0';
+    } else if ((character >= 'A') && (character <= 'F')) {
+      index = character - 'A' + 10;
+    } else if (character == '-') {
+      index = 16;
+    } else if (character == '.') {
+      index = 17;
+    } else if (character == ':') {
+      index = 18;
+    } else {
+      // blank
+      return 0;
+    }
+    // read from ROM memory
+    return pgm_read_byte (&DIGITS[index][row]);
+  }
+  // out of FONTS - blank
+  if (((uint8_t) character < 0x20) || ((uint8_t) character > 0x7f)) {
+    return 0;
+  }
+  // FONTS are stored by columns
+  for (col = 0; col < CHARS_COLS_LENGTH; col++) {
+    if (pgm_read_byte (&FONTS[character - 32][col]) & (1 << row)) {
+      bits |= 0x80 >> col;
+    }
+  }
+  // row of glyph
+  return bits;
+}
+
+/**
+ * @desc    Draw run of cells in one window
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_number *
+ * @param   const char * text - whole field
+ * @param   uint8_t first cell
+ * @param   uint8_t last cell
+ *
+ * @return  void
+ */
+static void ST7735_Number_Cells (struct st7735 * lcd, const struct st7735_number * number, const char * text, uint8_t first, uint8_t last)
+{
+  struct st7735_burst burst;
+  struct window win;
+  uint8_t large = number->flags & NUMBER_LARGE;
+  uint8_t width = large ? DIGITS_COLS_LENGTH : CHARS_COLS_LENGTH;
+  uint8_t height = large ? DIGITS_ROWS_LENGTH : CHARS_ROWS_LEN;
+  uint8_t advance = large ? (DIGITS_COLS_LENGTH + 2) : (CHARS_COLS_LENGTH + 1);
+  uint16_t right = number->x + (uint16_t) (last + 1) * advance - 1;
+  uint16_t bottom = number->y + height - 1;
+  uint8_t bits = 0;
+  uint8_t cell;
+  uint8_t gx;
+  uint8_t col, row;
+
+  // cells with their gaps
+  win.x0 = ((number->x + (uint16_t) first * advance) > 0xFF) ? 0xFF : number->x + first * advance;
+  win.x1 = (right > 0xFF) ? 0xFF : right;
+  win.y0 = number->y;
+  win.y1 = (bottom > 0xFF) ? 0xFF : bottom;
+  // nothing visible
+  if (ST7735_ClipWindow (lcd, &win) == ST7735_ERROR) {
+    return;
+  }
+  ST7735_Burst_Begin (lcd, &burst, win.x0, win.x1, win.y0, win.y1);
+  // loop through rows
+  for (row = win.y0 - number->y; row <= win.y1 - number->y; row++) {
+    // cell and its column at left edge
+    cell = (win.x0 - number->x) / advance;
+    gx = (win.x0 - number->x) % advance;
+    bits = ST7735_Number_Row (large, text[cell], row);
+    // loop through columns
+    for (col = win.x0; ; col++) {
+      // glyph pixel or gap
+      ST7735_Burst_Push (lcd, &burst, ((gx < width) && (bits & (0x80 >> gx))) ? number->fg : number->bg);
+      // end of row
+      if (col == win.x1) {
+        break;
+      }
+      // next cell
+      if (++gx == advance) {
+        gx = 0;
+        bits = ST7735_Number_Row (large, text[++cell], row);
+      }
+    }
+  }
+  ST7735_Burst_End (lcd, &burst);
+}
+
+/**
+ * @desc    Lay out sign and digits into field and draw changed cells
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_number *
+ * @param   char sign - '-' or 0
+ * @param   const char * body - digits
+ * @param   uint8_t length of body
+ *
+ * @return  void
+ */
+static void ST7735_Number_Layout (struct st7735 * lcd, struct st7735_number * number, char sign, const char * body, uint8_t length)
+{
+  char text[ST7735_NUMBER_CHARS];
+  uint8_t width = (number->width > ST7735_NUMBER_CHARS) ? ST7735_NUMBER_CHARS : number->width;
+  uint8_t total = length + (sign ? 1 : 0);
+  uint8_t i = 0;
+  uint8_t j;
+
+  // does not fit - dashes
+  if (total > width) {
+    while (i < width) {
+      text[i++] = '-';
+    }
+  // left aligned
+  } else if (number->flags & NUMBER_LEFT) {
+    if (sign) {
+      text[i++] = sign;
+    }
+    for (j = 0; j < length; j++) {
+      text[i++] = body[j];
+    }
+    while (i < width) {
+      text[i++] = ' ';
+    }
+  // right aligned
+  } else {
+    // spaces before sign
+    if (!(number->flags & NUMBER_ZERO)) {
+      while (i < width - total) {
+        text[i++] = ' ';
+      }
+    }
+    if (sign) {
+      text[i++] = sign;
+    }
+    // zeros after sign
+    while (i < width - length) {
+      text[i++] = '0';
+    }
+    for (j = 0; j < length; j++) {
+      text[i++] = body[j];
+    }
+  }
+  // loop through cells
+  for (i = 0; i < width; i++) {
+    // unchanged
+    if (text[i] == number->shown[i]) {
+      continue;
+    }
+    // run of changed cells
+    for (j = i; (j + 1 < width) && (text[j + 1] != number->shown[j + 1]); j++);
+    // one window per run
+    ST7735_Number_Cells (lcd, number, text, i, j);
+    // on display now
+    for (; i <= j; i++) {
+      number->shown[i] = text[i];
+    }
+  }
+}
+
+/**
+ * @desc    Draw signed integer
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_number *
+ * @param   int32_t value
+ *
+ * @return  void
+ */
+void ST7735_Number_Int (struct st7735 * lcd, struct st7735_number * number, int32_t value)
+{
+  ST7735_Number_Fixed (lcd, number, value, 0);
+}
+
+/**
+ * @desc    Draw fixed-point value
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_number *
+ * @param   int32_t value - scaled by 10^decimals, e.g. 2345 with 2 decimals = 23.45
+ * @param   uint8_t decimals - 0 - 9
+ *
+ * @return  void
+ */
+void ST7735_Number_Fixed (struct st7735 * lcd, struct st7735_number * number, int32_t value, uint8_t decimals)
+{
+  char body[ST7735_NUMBER_CHARS];
+  // magnitude, INT32_MIN included
+  uint32_t magnitude = (value < 0) ? (uint32_t) (-(value + 1)) + 1 : (uint32_t) value;
+  uint8_t length;
+  uint8_t i;
+
+  // limit
+  if (decimals > 9) {
+    decimals = 9;
+  }
+  // digits, at least one before point
+  length = ST7735_Number_Decimal (body, magnitude, decimals + 1);
+  // point before decimals
+  if (decimals) {
+    for (i = length; i > length - decimals; i--) {
+      body[i] = body[i - 1];
+    }
+    body[length - decimals] = '.';
+    length++;
+  }
+  ST7735_Number_Layout (lcd, number, (value < 0) ? '-' : 0, body, length);
+}
+
+/**
+ * @desc    Draw hex value
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_number *
+ * @param   uint32_t value
+ *
+ * @return  void
+ */
+void ST7735_Number_Hex (struct st7735 * lcd, struct st7735_number * number, uint32_t value)
+{
+  char body[8];
+  uint8_t length = 0;
+  uint8_t nibble;
+  int8_t shift;
+
+  // loop through nibbles from top
+  for (shift = 28; shift >= 0; shift -= 4) {
+    nibble = (value >> shift) & 0x0F;
+    // leading zeros left out, last one kept
+    if (length || nibble || (shift == 0)) {
+      body[length++] = (nibble < 10) ? ('0' + nibble) : ('A' + nibble - 10);
+    }
+  }
+  ST7735_Number_Layout (lcd, number, 0, body, length);
+}
@@ -0,0 +1,105 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - number fields
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_number.h
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735.h, font.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Signed integers, fixed-point and hex values are converted digit by digit into
+ *              field of fixed width, no printf. Field remembers characters on display and
+ *              redraws only changed cells, opaque with background, so no clear is needed.
+ *              Small font is FONTS 5x8, large one DIGITS 8x14 (0-9 A-F - . :).
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include "st7735.h"
+
+#ifndef __ST7735_NUMBER_H__
+#define __ST7735_NUMBER_H__
+
+  // Number field
+  // -----------------------------------
+  #define ST7735_NUMBER_CHARS   12                // max characters of field
+
+  /** @enum Number - flags of field ored */
+  enum Number {
+    // aligned to right edge, padded by spaces
+    NUMBER_RIGHT = 0x00,
+    // aligned to left edge
+    NUMBER_LEFT = 0x01,
+    // padded by zeros, right aligned only
+    NUMBER_ZERO = 0x02,
+    // large digits font DIGITS 8x14 instead of FONTS 5x8
+    NUMBER_LARGE = 0x04
+  };
+
+  /** @struct Number field */
+  struct st7735_number {
+    // left top corner
+    uint8_t x;
+    uint8_t y;
+    // characters of field, max ST7735_NUMBER_CHARS
+    uint8_t width;
+    // enum Number
+    uint8_t flags;
+    // colors of digits and background
+    uint16_t fg;
+    uint16_t bg;
+    // characters on display, 0 = not drawn yet
+    char shown[ST7735_NUMBER_CHARS];
+  };
+
+  /**
+   * @desc    Decimal digits of value
+   *
+   * @param   char *
+   * @param   uint32_t
+   * @param   uint8_t
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_Number_Decimal (char *, uint32_t, uint8_t);
+
+  /**
+   * @desc    Draw signed integer
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_number *
+   * @param   int32_t
+   *
+   * @return  void
+   */
+  void ST7735_Number_Int (struct st7735 *, struct st7735_number *, int32_t);
+
+  /**
+   * @desc    Draw fixed-point value
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_number *
+   * @param   int32_t
+   * @param   uint8_t
+   *
+   * @return  void
+   */
+  void ST7735_Number_Fixed (struct st7735 *, struct st7735_number *, int32_t, uint8_t);
+
+  /**
+   * @desc    Draw hex value
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_number *
+   * @param   uint32_t
+   *
+   * @return  void
+   */
+  void ST7735_Number_Hex (struct st7735 *, struct st7735_number *, uint32_t);
+
+#endif
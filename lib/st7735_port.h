@@ -0,0 +1,61 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - platform definitions
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_port.h
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      avr/pgmspace.h, util/delay.h (AVR)
+ * --------------------------------------------------------------------------------------------+
+ * @descr       AVR uses flash access and delay from avr-libc. On other targets (Linux
+ *              gateway build) flash is ordinary memory and delay maps to usleep.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#ifndef __ST7735_PORT_H__
+#define __ST7735_PORT_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__AVR__)
+
+  #include <avr/io.h>
+  #include <avr/pgmspace.h>
+  #include <util/delay.h>
+
+#else
+
+  #include <string.h>
+  #include <unistd.h>
+
+  // flash is ordinary memory
+  #define PROGMEM
+  #define pgm_read_byte(addr)   (*(const uint8_t *) (addr))
+  #define pgm_read_word(addr)   (*(const uint16_t *) (addr))
+  #define pgm_read_dword(addr)  (*(const uint32_t *) (addr))
+  #define memcpy_P(dst, src, n) memcpy ((dst), (src), (n))
+  // delay
+  #define _delay_ms(ms)         usleep ((useconds_t) (ms) * 1000)
+
+#endif
+
+  /**
+   * @desc    Read 16 bits from flash, high byte first
+   *
+   * @param   const uint8_t *
+   *
+   * @return  uint16_t
+   */
+  static inline uint16_t ST7735_Flash_Word (const uint8_t * addr)
+  {
+    return ((uint16_t) pgm_read_byte (addr) << 8) | pgm_read_byte (addr + 1);
+  }
+
+#endif
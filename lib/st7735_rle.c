@@ -0,0 +1,119 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - run length coded pixels
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       19.10.2026
+ * @file        st7735_rle.c
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735_rle.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       RLE has to be decoded from start, so pixels out of visible part are skipped
+ *              and decoding stops behind last visible row. Encoder takes runs of 3 and
+ *              more, shorter ones are cheaper as literals.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include "st7735_port.h"
+#include "st7735_rle.h"
+
+/**
+ * @desc    Decode pixels into burst, only visible part pushed
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_burst *
+ * @param   const uint8_t * code - runs
+ * @param   uint8_t w - width of coded pixels
+ * @param   const struct window * - visible part relative to coded pixels
+ *
+ * @return  const uint8_t * - behind last decoded operation
+ */
+const uint8_t * ST7735_RLE_Burst (struct st7735 * lcd, struct st7735_burst * burst, const uint8_t * code, uint8_t w, const struct window * win)
+{
+  uint16_t color = 0;
+  uint8_t length;
+  uint8_t op;
+  uint8_t row = 0;
+  uint8_t col = 0;
+
+  // up to last visible row
+  while (row <= win->y1) {
+    op = pgm_read_byte (code++);
+    length = (op & ~ST7735_RLE_RUN) + 1;
+    // one color repeated
+    if (op & ST7735_RLE_RUN) {
+      color = ST7735_Flash_Word (code);
+      code += 2;
+    }
+    while (length--) {
+      // literal colors
+      if (!(op & ST7735_RLE_RUN)) {
+        color = ST7735_Flash_Word (code);
+        code += 2;
+      }
+      // visible
+      if ((row >= win->y0) && (col >= win->x0) && (col <= win->x1)) {
+        ST7735_Burst_Push (lcd, burst, color);
+      }
+      // next pixel
+      if (++col == w) {
+        col = 0;
+        // behind last visible row
+        if (row++ == win->y1) {
+          break;
+        }
+      }
+    }
+  }
+  // behind decoded pixels
+  return code;
+}
+
+/**
+ * @desc    Encode pixels
+ *
+ * @param   uint8_t * out - ST7735_RLE_BOUND (n) bytes
+ * @param   const uint16_t * pixels
+ * @param   uint16_t n - count of pixels
+ *
+ * @return  uint32_t - bytes written
+ */
+uint32_t ST7735_RLE_Encode (uint8_t * out, const uint16_t * pixels, uint16_t n)
+{
+  uint32_t length = 0;
+  uint16_t i = 0;
+  uint16_t run;
+  uint16_t lit;
+  uint16_t k;
+
+  while (i < n) {
+    // same colors
+    for (run = 1; (i + run < n) && (run < ST7735_RLE_MAX) && (pixels[i + run] == pixels[i]); run++);
+    if (run >= 3) {
+      out[length++] = ST7735_RLE_RUN | (run - 1);
+      out[length++] = pixels[i] >> 8;
+      out[length++] = pixels[i];
+      i += run;
+      continue;
+    }
+    // literal colors up to next run of 3
+    for (lit = 1; (i + lit < n) && (lit < ST7735_RLE_MAX); lit++) {
+      if ((i + lit + 2 < n) && (pixels[i + lit] == pixels[i + lit + 1]) && (pixels[i + lit] == pixels[i + lit + 2])) {
+        break;
+      }
+    }
+    out[length++] = lit - 1;
+    for (k = 0; k < lit; k++) {
+      out[length++] = pixels[i + k] >> 8;
+      out[length++] = pixels[i + k];
+    }
+    i += lit;
+  }
+  // bytes written
+  return length;
+}
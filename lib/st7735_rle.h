@@ -0,0 +1,61 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - run length coded pixels
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       19.10.2026
+ * @file        st7735_rle.h
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Pixels of RLE assets and animation rectangles, row after row, colors high
+ *              byte first:
+ *
+ *                0nnnnnnn hi lo ...    n + 1 literal colors
+ *                1nnnnnnn hi lo        n + 1 times the same color
+ *
+ *              Decoder is used by players on target, encoder by host tools.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include "st7735.h"
+
+#ifndef __ST7735_RLE_H__
+#define __ST7735_RLE_H__
+
+  // RLE format
+  // -----------------------------------
+  #define ST7735_RLE_RUN        0x80              // run of one color, else literal colors
+  #define ST7735_RLE_MAX        128               // max pixels per operation
+  #define ST7735_RLE_BOUND(n)   (((uint32_t) (n) << 1) + ((n) + ST7735_RLE_MAX - 1) / ST7735_RLE_MAX)
+
+  /**
+   * @desc    Decode pixels into burst, only visible part pushed
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_burst *
+   * @param   const uint8_t *
+   * @param   uint8_t
+   * @param   const struct window *
+   *
+   * @return  const uint8_t *
+   */
+  const uint8_t * ST7735_RLE_Burst (struct st7735 *, struct st7735_burst *, const uint8_t *, uint8_t, const struct window *);
+
+  /**
+   * @desc    Encode pixels
+   *
+   * @param   uint8_t *
+   * @param   const uint16_t *
+   * @param   uint16_t
+   *
+   * @return  uint32_t
+   */
+  uint32_t ST7735_RLE_Encode (uint8_t *, const uint16_t *, uint16_t);
+
+#endif
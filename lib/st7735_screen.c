@@ -0,0 +1,199 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - static screens from flash
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_screen.c
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735_screen.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       One loop reads operation and operands from flash and calls primitives, so
+ *              screen of dozens of items costs bytes of operands instead of call sequence
+ *              with constants loaded into registers for each item.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include "st7735_port.h"
+#include "st7735_screen.h"
+
+/**
+ * @desc    Draw 1 bit per pixel bitmap from flash
+ *
+ * @param   struct st7735 *
+ * @param   const uint8_t * operands - x y w h rows
+ * @param   uint16_t color - set bits
+ * @param   uint16_t color - clear bits
+ *
+ * @return  const uint8_t * - behind bitmap
+ */
+static const uint8_t * ST7735_Screen_Bitmap (struct st7735 * lcd, const uint8_t * code, uint16_t fg, uint16_t bg)
+{
+  struct st7735_burst burst;
+  struct window win;
+  uint8_t x = pgm_read_byte (code++);
+  uint8_t y = pgm_read_byte (code++);
+  uint8_t w = pgm_read_byte (code++);
+  uint8_t h = pgm_read_byte (code++);
+  // bytes per row
+  uint8_t stride = (w + 7) >> 3;
+  const uint8_t * bits;
+  uint8_t byte;
+  uint8_t col, row;
+
+  // empty bitmap
+  if ((w == 0) || (h == 0)) {
+    return code;
+  }
+  // whole bitmap
+  win.x0 = x;
+  win.x1 = ((x + w - 1) > 0xFF) ? 0xFF : x + w - 1;
+  win.y0 = y;
+  win.y1 = ((y + h - 1) > 0xFF) ? 0xFF : y + h - 1;
+  // visible part
+  if (ST7735_ClipWindow (lcd, &win) == ST7735_ERROR) {
+    return code + (uint16_t) stride * h;
+  }
+  ST7735_Burst_Begin (lcd, &burst, win.x0, win.x1, win.y0, win.y1);
+  // loop through rows
+  for (row = win.y0 - y; ; row++) {
+    // first byte of visible part
+    bits = code + (uint16_t) row * stride + ((win.x0 - x) >> 3);
+    byte = pgm_read_byte (bits++);
+    // loop through columns
+    for (col = win.x0 - x; ; col++) {
+      ST7735_Burst_Push (lcd, &burst, (byte & (0x80 >> (col & 7))) ? fg : bg);
+      // end of row
+      if (col == win.x1 - x) {
+        break;
+      }
+      // next byte
+      if ((col & 7) == 7) {
+        byte = pgm_read_byte (bits++);
+      }
+    }
+    // end of window
+    if (row == win.y1 - y) {
+      break;
+    }
+  }
+  ST7735_Burst_End (lcd, &burst);
+  // behind bitmap
+  return code + (uint16_t) stride * h;
+}
+
+/**
+ * @desc    Stream colors from flash into window
+ *
+ * @param   struct st7735 *
+ * @param   const uint8_t * operands - count, colors
+ * @param   struct window * window
+ *
+ * @return  const uint8_t * - behind colors
+ */
+static const uint8_t * ST7735_Screen_Pixels (struct st7735 * lcd, const uint8_t * code, const struct window * win)
+{
+  struct st7735_burst burst;
+  uint16_t count;
+  uint16_t color;
+
+  // number of pixels
+  count = ST7735_Flash_Word (code);
+  code += 2;
+  // window out of screen
+  if (ST7735_Burst_Begin (lcd, &burst, win->x0, win->x1, win->y0, win->y1) == ST7735_ERROR) {
+    return code + (count << 1);
+  }
+  // counter
+  while (count--) {
+    // high byte first
+    color = ST7735_Flash_Word (code);
+    code += 2;
+    ST7735_Burst_Push (lcd, &burst, color);
+  }
+  ST7735_Burst_End (lcd, &burst);
+  // behind colors
+  return code;
+}
+
+/**
+ * @desc    Draw screen from flash
+ *
+ * @param   struct st7735 *
+ * @param   const uint8_t * code - ended by ST7735_SCREEN_END
+ *
+ * @return  uint8_t - ST7735_ERROR on unknown operation
+ */
+uint8_t ST7735_Screen (struct st7735 * lcd, const uint8_t * code)
+{
+  struct window win = { .x0 = 0, .x1 = 0, .y0 = 0, .y1 = 0 };
+  uint16_t fg = WHITE;
+  uint16_t bg = BLACK;
+  uint8_t arg[4];
+  uint8_t size;
+  uint8_t length;
+  uint8_t op;
+
+  // loop through operations
+  while ((op = pgm_read_byte (code++)) != ST7735_SCREEN_END) {
+    switch (op) {
+      // colors
+      case ST7735_SCREEN_COLOR:
+      case ST7735_SCREEN_BACKGROUND:
+        if (op == ST7735_SCREEN_COLOR) {
+          fg = ST7735_Flash_Word (code);
+        } else {
+          bg = ST7735_Flash_Word (code);
+        }
+        code += 2;
+        break;
+      // whole screen
+      case ST7735_SCREEN_CLEAR:
+        ST7735_ClearScreen (lcd, bg);
+        break;
+      // primitives with 4 coordinates
+      case ST7735_SCREEN_RECT:
+      case ST7735_SCREEN_LINE:
+      case ST7735_SCREEN_WINDOW:
+        memcpy_P (arg, code, 4);
+        code += 4;
+        if (op == ST7735_SCREEN_RECT) {
+          ST7735_DrawRectangle (lcd, arg[0], arg[1], arg[2], arg[3], fg);
+        } else if (op == ST7735_SCREEN_LINE) {
+          ST7735_DrawLine (lcd, arg[0], arg[1], arg[2], arg[3], fg);
+        } else {
+          win = (struct window) { .x0 = arg[0], .x1 = arg[1], .y0 = arg[2], .y1 = arg[3] };
+        }
+        break;
+      // text read from flash
+      case ST7735_SCREEN_TEXT:
+        arg[0] = pgm_read_byte (code++);
+        arg[1] = pgm_read_byte (code++);
+        size = pgm_read_byte (code++);
+        length = pgm_read_byte (code++);
+        ST7735_SetPosition (lcd, arg[0], arg[1]);
+        while (length--) {
+          ST7735_DrawChar (lcd, pgm_read_byte (code++), fg, size);
+        }
+        break;
+      // 1 bit per pixel
+      case ST7735_SCREEN_BITMAP:
+        code = ST7735_Screen_Bitmap (lcd, code, fg, bg);
+        break;
+      // colors into window
+      case ST7735_SCREEN_PIXELS:
+        code = ST7735_Screen_Pixels (lcd, code, &win);
+        break;
+      // operands unknown, rest cannot be parsed
+      default:
+        return ST7735_ERROR;
+    }
+  }
+  // success
+  return ST7735_SUCCESS;
+}
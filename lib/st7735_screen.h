@@ -0,0 +1,63 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - static screens from flash
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_screen.h
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Screen is byte code in PROGMEM like INIT_ST7735B: operation byte followed
+ *              by its operands, terminated by ST7735_SCREEN_END. Colors are high byte first.
+ *
+ *                COLOR       hi lo                  foreground
+ *                BACKGROUND  hi lo                  background
+ *                CLEAR                              whole screen background
+ *                RECT        x0 x1 y0 y1            filled, foreground
+ *                LINE        x1 x2 y1 y2            foreground
+ *                TEXT        x y size n chars...    foreground, enum Size
+ *                BITMAP      x y w h rows...        1 bit per pixel, MSB left, row padded
+ *                                                   to bytes, foreground / background
+ *                WINDOW      x0 x1 y0 y1            window of PIXELS
+ *                PIXELS      hi lo colors...        count, then colors high byte first
+ *
+ *              tools/st7735_screen compiles text description into such array.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include "st7735.h"
+
+#ifndef __ST7735_SCREEN_H__
+#define __ST7735_SCREEN_H__
+
+  /** @enum Screen operations */
+  enum st7735_screen_op {
+    ST7735_SCREEN_END = 0x00,
+    ST7735_SCREEN_COLOR,
+    ST7735_SCREEN_BACKGROUND,
+    ST7735_SCREEN_CLEAR,
+    ST7735_SCREEN_RECT,
+    ST7735_SCREEN_LINE,
+    ST7735_SCREEN_TEXT,
+    ST7735_SCREEN_BITMAP,
+    ST7735_SCREEN_WINDOW,
+    ST7735_SCREEN_PIXELS
+  };
+
+  /**
+   * @desc    Draw screen from flash
+   *
+   * @param   struct st7735 *
+   * @param   const uint8_t *
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_Screen (struct st7735 *, const uint8_t *);
+
+#endif
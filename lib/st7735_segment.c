@@ -0,0 +1,191 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - seven-segment digits
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_segment.c
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735_segment.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Vertical segments sit between horizontal ones, corners thickness x thickness
+ *              belong to no segment and stay background.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include "st7735_port.h"
+#include "st7735_segment.h"
+#include "st7735_number.h"
+
+/** @array Segments of 0 - 9, A - F */
+static const uint8_t SEGMENTS[16] PROGMEM = {
+  0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07,
+  0x7F, 0x6F, 0x77, 0x7C, 0x39, 0x5E, 0x79, 0x71
+};
+
+/**
+ * @desc    Draw one segment
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_segment *
+ * @param   uint8_t index of digit
+ * @param   uint8_t segment - bit of mask
+ * @param   uint16_t color
+ *
+ * @return  void
+ */
+static void ST7735_Segment_Draw (struct st7735 * lcd, const struct st7735_segment * display, uint8_t index, uint8_t segment, uint16_t color)
+{
+  uint8_t t = display->thickness;
+  // left top corner of digit
+  uint8_t x0 = display->x + index * (display->width + display->gap);
+  uint8_t y0 = display->y;
+  // right bottom corner of digit
+  uint8_t x1 = x0 + display->width - 1;
+  uint8_t y1 = y0 + display->height - 1;
+  // top of middle segment
+  uint8_t ym = y0 + ((display->height - t) >> 1);
+
+  // horizontal segments
+  if (segment == SEGMENT_A) {
+    ST7735_DrawRectangle (lcd, x0 + t, x1 - t, y0, y0 + t - 1, color);
+  } else if (segment == SEGMENT_G) {
+    ST7735_DrawRectangle (lcd, x0 + t, x1 - t, ym, ym + t - 1, color);
+  } else if (segment == SEGMENT_D) {
+    ST7735_DrawRectangle (lcd, x0 + t, x1 - t, y1 - t + 1, y1, color);
+  // vertical segments
+  } else if (segment == SEGMENT_F) {
+    ST7735_DrawRectangle (lcd, x0, x0 + t - 1, y0 + t, ym - 1, color);
+  } else if (segment == SEGMENT_B) {
+    ST7735_DrawRectangle (lcd, x1 - t + 1, x1, y0 + t, ym - 1, color);
+  } else if (segment == SEGMENT_E) {
+    ST7735_DrawRectangle (lcd, x0, x0 + t - 1, ym + t, y1 - t, color);
+  } else if (segment == SEGMENT_C) {
+    ST7735_DrawRectangle (lcd, x1 - t + 1, x1, ym + t, y1 - t, color);
+  }
+}
+
+/**
+ * @desc    Draw all segments off
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_segment *
+ *
+ * @return  void
+ */
+void ST7735_Segment_Init (struct st7735 * lcd, struct st7735_segment * display)
+{
+  uint8_t i;
+
+  // whole display off
+  ST7735_DrawRectangle (lcd, display->x, display->x + display->digits * (display->width + display->gap) - display->gap - 1, display->y, display->y + display->height - 1, display->bg);
+  // loop through digits
+  for (i = 0; i < display->digits; i++) {
+    display->shown[i] = 0;
+  }
+}
+
+/**
+ * @desc    Set segments of one digit
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_segment *
+ * @param   uint8_t index of digit, 0 = left
+ * @param   uint8_t mask - SEGMENT_x ored
+ *
+ * @return  void
+ */
+void ST7735_Segment_Set (struct st7735 * lcd, struct st7735_segment * display, uint8_t index, uint8_t mask)
+{
+  uint8_t changed;
+  uint8_t segment;
+
+  // no such digit
+  if (index >= display->digits) {
+    return;
+  }
+  // segments which changed state
+  changed = (display->shown[index] ^ mask) & 0x7F;
+  // loop through segments
+  for (segment = SEGMENT_A; changed; segment <<= 1) {
+    if (changed & segment) {
+      // on or off
+      ST7735_Segment_Draw (lcd, display, index, segment, (mask & segment) ? display->fg : display->bg);
+      changed &= ~segment;
+    }
+  }
+  // on display now
+  display->shown[index] = mask & 0x7F;
+}
+
+/**
+ * @desc    Set character of one digit
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_segment *
+ * @param   uint8_t index of digit, 0 = left
+ * @param   char character - 0 - 9, A - F, a - f, '-', other blank
+ *
+ * @return  void
+ */
+void ST7735_Segment_Char (struct st7735 * lcd, struct st7735_segment * display, uint8_t index, char character)
+{
+  uint8_t mask = 0;
+
+  // digits
+  if ((character >= '0') && (character <= '9')) {
+    mask = pgm_read_byte (&SEGMENTS[character - '0']);
+  // hex letters
+  } else if ((character >= 'A') && (character <= 'F')) {
+    mask = pgm_read_byte (&SEGMENTS[character - 'A' + 10]);
+  } else if ((character >= 'a') && (character <= 'f')) {
+    mask = pgm_read_byte (&SEGMENTS[character - 'a' + 10]);
+  // minus
+  } else if (character == '-') {
+    mask = SEGMENT_G;
+  }
+  ST7735_Segment_Set (lcd, display, index, mask);
+}
+
+/**
+ * @desc    Show signed integer, right aligned
+ *          value which does not fit is shown as dashes
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_segment *
+ * @param   int32_t value
+ *
+ * @return  void
+ */
+void ST7735_Segment_Int (struct st7735 * lcd, struct st7735_segment * display, int32_t value)
+{
+  char body[10];
+  // magnitude, INT32_MIN included
+  uint32_t magnitude = (value < 0) ? (uint32_t) (-(value + 1)) + 1 : (uint32_t) value;
+  uint8_t length = ST7735_Number_Decimal (body, magnitude, 1);
+  uint8_t total = length + ((value < 0) ? 1 : 0);
+  uint8_t first = display->digits - total;
+  uint8_t i;
+
+  // loop through digits
+  for (i = 0; i < display->digits; i++) {
+    // does not fit
+    if (total > display->digits) {
+      ST7735_Segment_Char (lcd, display, i, '-');
+    // blank before value
+    } else if (i < first) {
+      ST7735_Segment_Char (lcd, display, i, ' ');
+    // sign
+    } else if ((value < 0) && (i == first)) {
+      ST7735_Segment_Char (lcd, display, i, '-');
+    // digit
+    } else {
+      ST7735_Segment_Char (lcd, display, i, body[i - display->digits + length]);
+    }
+  }
+}
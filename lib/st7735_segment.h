@@ -0,0 +1,109 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - seven-segment digits
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_segment.h
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735.h, st7735_number.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Digit of any size is 7 filled rectangles, each one window burst. Display keeps
+ *              segment masks on screen and redraws only segments which changed state, e.g.
+ *              8 -> 9 sends one rectangle.
+ *
+ *                  aaa
+ *                 f   b
+ *                  ggg
+ *                 e   c
+ *                  ddd
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include "st7735.h"
+
+#ifndef __ST7735_SEGMENT_H__
+#define __ST7735_SEGMENT_H__
+
+  // Segment masks
+  // -----------------------------------
+  #define SEGMENT_A             0x01
+  #define SEGMENT_B             0x02
+  #define SEGMENT_C             0x04
+  #define SEGMENT_D             0x08
+  #define SEGMENT_E             0x10
+  #define SEGMENT_F             0x20
+  #define SEGMENT_G             0x40
+
+  /** @struct Seven-segment display */
+  struct st7735_segment {
+    // left top corner of first digit
+    uint8_t x;
+    uint8_t y;
+    // size of one digit
+    uint8_t width;
+    uint8_t height;
+    // thickness of segment
+    uint8_t thickness;
+    // pixels between digits
+    uint8_t gap;
+    // number of digits
+    uint8_t digits;
+    // colors of segments on and off
+    uint16_t fg;
+    uint16_t bg;
+    // segment masks on display, array of digits items
+    uint8_t * shown;
+  };
+
+  /**
+   * @desc    Draw all segments off
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_segment *
+   *
+   * @return  void
+   */
+  void ST7735_Segment_Init (struct st7735 *, struct st7735_segment *);
+
+  /**
+   * @desc    Set segments of one digit
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_segment *
+   * @param   uint8_t
+   * @param   uint8_t
+   *
+   * @return  void
+   */
+  void ST7735_Segment_Set (struct st7735 *, struct st7735_segment *, uint8_t, uint8_t);
+
+  /**
+   * @desc    Set character of one digit
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_segment *
+   * @param   uint8_t
+   * @param   char
+   *
+   * @return  void
+   */
+  void ST7735_Segment_Char (struct st7735 *, struct st7735_segment *, uint8_t, char);
+
+  /**
+   * @desc    Show signed integer
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_segment *
+   * @param   int32_t
+   *
+   * @return  void
+   */
+  void ST7735_Segment_Int (struct st7735 *, struct st7735_segment *, int32_t);
+
+#endif
@@ -0,0 +1,436 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - shared SPI bus manager
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       19.10.2026
+ * @file        st7735_shared.c
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735_shared.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Single threaded, queues must not be touched from interrupts. ST7735 takes
+ *              chip select high between bytes as pause, D/C decides command or data, so
+ *              display may hold the bus across commands and give it up inside RAMWR.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include "st7735_port.h"
+#include "st7735_shared.h"
+
+#if defined(__AVR__)
+
+/**
+ * @desc    Set clock step and mode of hardware SPI
+ *
+ * @param   uint8_t step - 0 = fclk/2 ... 6 = fclk/128
+ * @param   uint8_t mode - ST7735_SPI_x ored
+ *
+ * @return  void
+ */
+static void ST7735_SPI_PortSetup (uint8_t step, uint8_t mode)
+{
+  // enabled master, mode, SPR1:0 - fclk/4, /16, /64, /128
+  SPCR = (1 << SPE) | (1 << MSTR) | (mode & (ST7735_SPI_CPHA | ST7735_SPI_CPOL | ST7735_SPI_LSB)) | (step >> 1);
+  // SPI2X doubles even steps, fclk/128 has no doubled pair
+  if ((step & 1) || (step >= ST7735_CLOCK_STEPS - 1)) {
+    CLR_BIT (SPSR, SPI2X);
+  } else {
+    SET_BIT (SPSR, SPI2X);
+  }
+}
+
+/**
+ * @desc    Exchange bytes on hardware SPI
+ *
+ * @param   const uint8_t * tx - NULL = 0xFF
+ * @param   uint8_t * rx - NULL = dropped
+ * @param   uint16_t length
+ *
+ * @return  void
+ */
+static void ST7735_SPI_PortExchange (const uint8_t * tx, uint8_t * rx, uint16_t length)
+{
+  // loop through bytes
+  while (length--) {
+    SPDR = tx ? *tx++ : 0xFF;
+    // wait till data transmit
+    WAIT_UNTIL_BIT_IS_SET (SPSR, SPIF);
+    if (rx) {
+      *rx++ = SPDR;
+    }
+  }
+}
+
+/** @const AVR hardware SPI */
+const struct st7735_spi_port ST7735_SPI_PORT = {
+  .setup    = ST7735_SPI_PortSetup,
+  .exchange = ST7735_SPI_PortExchange
+};
+
+#endif
+
+/**
+ * @desc    Release chip select of owner
+ *
+ * @param   struct st7735_shared *
+ *
+ * @return  void
+ */
+void ST7735_Shared_Release (struct st7735_shared * shared)
+{
+  if (shared->owner != NULL) {
+    // chip select idle high
+    SET_BIT (*(shared->owner->cs->port), shared->owner->cs->pin);
+    shared->owner = NULL;
+  }
+}
+
+/**
+ * @desc    Give bus to device
+ *
+ * @param   struct st7735_shared *
+ * @param   struct st7735_device *
+ * @param   uint8_t clock - step
+ *
+ * @return  void
+ */
+static void ST7735_Shared_Acquire (struct st7735_shared * shared, struct st7735_device * dev, uint8_t clock)
+{
+  // other device selected
+  if (shared->owner != dev) {
+    ST7735_Shared_Release (shared);
+  }
+  // setup only on change
+  if ((shared->clock != clock) || (shared->mode != dev->mode)) {
+    shared->port->setup (clock, dev->mode);
+    shared->clock = clock;
+    shared->mode = dev->mode;
+  }
+  // chip select active low
+  if (shared->owner != dev) {
+    CLR_BIT (*(dev->cs->port), dev->cs->pin);
+    shared->owner = dev;
+    dev->count = 0;
+  }
+}
+
+/**
+ * @desc    Next device with queued transfers, round robin
+ *
+ * @param   struct st7735_shared *
+ *
+ * @return  struct st7735_device * - NULL = queues empty
+ */
+static struct st7735_device * ST7735_Shared_Next (struct st7735_shared * shared)
+{
+  struct st7735_device * dev = shared->turn;
+
+  // no devices
+  if (dev == NULL) {
+    return NULL;
+  }
+  // loop through devices once
+  do {
+    if (dev->head != NULL) {
+      return dev;
+    }
+    dev = dev->next ? dev->next : shared->devices;
+  } while (dev != shared->turn);
+  // queues empty
+  return NULL;
+}
+
+/**
+ * @desc    Init shared bus
+ *
+ * @param   struct st7735_shared * - port, slot filled
+ *
+ * @return  void
+ */
+void ST7735_Shared_Init (struct st7735_shared * shared)
+{
+#if defined(__AVR__)
+  // hardware SPI pins
+  if (shared->port == NULL) {
+    shared->port = &ST7735_SPI_PORT;
+    ST7735_SPI_Init ();
+  }
+#endif
+  // slot counts data bytes after command, pixels of RAMWR not split
+  shared->slot &= ~1;
+  shared->devices = NULL;
+  shared->owner = NULL;
+  shared->turn = NULL;
+  // force setup by first device
+  shared->clock = 0xFF;
+  shared->mode = 0xFF;
+}
+
+/**
+ * @desc    Attach device, chip select released
+ *
+ * @param   struct st7735_shared *
+ * @param   struct st7735_device * - cs, dc, clock, mode filled
+ *
+ * @return  void
+ */
+void ST7735_Shared_Attach (struct st7735_shared * shared, struct st7735_device * dev)
+{
+  struct st7735_device ** last = &shared->devices;
+
+  // chip select output high
+  SET_BIT (*(dev->cs->port), dev->cs->pin);
+  SET_BIT (*(dev->cs->ddr), dev->cs->pin);
+  // data / command output
+  if (dev->dc != NULL) {
+    SET_BIT (*(dev->dc->ddr), dev->dc->pin);
+  }
+  dev->shared = shared;
+  dev->head = dev->tail = NULL;
+  dev->reading = 0;
+  dev->next = NULL;
+  // append
+  while (*last != NULL) {
+    last = &(*last)->next;
+  }
+  *last = dev;
+  if (shared->turn == NULL) {
+    shared->turn = dev;
+  }
+}
+
+/**
+ * @desc    Queue transfer
+ *
+ * @param   struct st7735_device *
+ * @param   struct st7735_transfer * - tx, rx, length, flags, done filled
+ *
+ * @return  void
+ */
+void ST7735_Shared_Queue (struct st7735_device * dev, struct st7735_transfer * xfer)
+{
+  xfer->next = NULL;
+  // append
+  if (dev->tail != NULL) {
+    dev->tail->next = xfer;
+  } else {
+    dev->head = xfer;
+  }
+  dev->tail = xfer;
+}
+
+/**
+ * @desc    Serve queued transfers round robin, started batch is finished
+ *
+ * @param   struct st7735_shared *
+ * @param   uint16_t budget - bytes, checked between batches, first batch always served
+ *
+ * @return  uint8_t - ST7735_BUSY if transfers left / ST7735_SUCCESS
+ */
+uint8_t ST7735_Shared_Run (struct st7735_shared * shared, uint16_t budget)
+{
+  struct st7735_device * dev;
+  struct st7735_transfer * xfer;
+  uint16_t sent = 0;
+
+  // loop through batches
+  while ((dev = ST7735_Shared_Next (shared)) != NULL) {
+    // budget spent
+    if (sent && (sent >= budget)) {
+      return ST7735_BUSY;
+    }
+    ST7735_Shared_Acquire (shared, dev, dev->clock);
+    // loop through transfers of batch
+    do {
+      xfer = dev->head;
+      // data / command
+      if (dev->dc != NULL) {
+        if (xfer->flags & ST7735_XFER_COMMAND) {
+          CLR_BIT (*(dev->dc->port), dev->dc->pin);
+        } else {
+          SET_BIT (*(dev->dc->port), dev->dc->pin);
+        }
+      }
+      shared->port->exchange (xfer->tx, xfer->rx, xfer->length);
+      sent += xfer->length;
+      // dequeue before callback, it may queue continuation
+      dev->head = xfer->next;
+      if (dev->head == NULL) {
+        dev->tail = NULL;
+      }
+      if (xfer->done != NULL) {
+        xfer->done (xfer);
+      }
+    } while ((xfer->flags & ST7735_XFER_HOLD) && (dev->head != NULL));
+    ST7735_Shared_Release (shared);
+    // next device first in next round
+    shared->turn = dev->next ? dev->next : shared->devices;
+  }
+  // queues empty
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Display pins
+ *
+ * @param   struct st7735 *
+ *
+ * @return  void
+ */
+static void ST7735_SHARED_Init (struct st7735 * lcd)
+{
+  // DDR
+  // --------------------------------------
+  SET_BIT (*(lcd->dc->ddr), lcd->dc->pin);
+  SET_BIT (*(lcd->rs->ddr), lcd->rs->pin);
+  // PORT
+  // --------------------------------------
+  SET_BIT (*(lcd->rs->port), lcd->rs->pin);     // Reset H
+  // back light is optional
+  if (lcd->bl != NULL) {
+    SET_BIT (*(lcd->bl->ddr), lcd->bl->pin);
+    SET_BIT (*(lcd->bl->port), lcd->bl->pin);   // BackLigt ON
+  }
+}
+
+/**
+ * @desc    Chip select of display, bus kept till other device needs it
+ *
+ * @param   struct st7735 *
+ * @param   uint8_t 1 = selected, 0 = released, ST7735_SELECT_READ
+ *
+ * @return  void
+ */
+static void ST7735_SHARED_Select (struct st7735 * lcd, uint8_t state)
+{
+  struct st7735_device * dev = lcd->bus_data;
+  struct st7735_shared * shared = dev->shared;
+
+  if (state) {
+    dev->reading = (state == ST7735_SELECT_READ);
+    // reads may need slower clock
+    ST7735_Shared_Acquire (shared, dev, dev->reading ? lcd->clock_read : lcd->clock);
+    return;
+  }
+  // read ends by chip select rising
+  if (dev->reading) {
+    dev->reading = 0;
+    ST7735_Shared_Release (shared);
+  }
+  // queued devices slot in between display transactions
+  ST7735_Shared_Run (shared, shared->slot);
+}
+
+/**
+ * @desc    Data / Command
+ *
+ * @param   struct st7735 *
+ * @param   uint8_t ST7735_DATA / ST7735_COMMAND
+ *
+ * @return  void
+ */
+static void ST7735_SHARED_Mode (struct st7735 * lcd, uint8_t mode)
+{
+  struct st7735_device * dev = lcd->bus_data;
+
+  // restored after other devices
+  dev->level = mode;
+  // data after command counted from zero
+  if (mode == ST7735_COMMAND) {
+    dev->count = 0;
+  }
+  if (mode == ST7735_DATA) {
+    SET_BIT (*(lcd->dc->port), lcd->dc->pin);
+  } else {
+    CLR_BIT (*(lcd->dc->port), lcd->dc->pin);
+  }
+}
+
+/**
+ * @desc    Reset line level
+ *
+ * @param   struct st7735 *
+ * @param   uint8_t
+ *
+ * @return  void
+ */
+static void ST7735_SHARED_Reset (struct st7735 * lcd, uint8_t level)
+{
+  if (level) {
+    SET_BIT (*(lcd->rs->port), lcd->rs->pin);
+  } else {
+    CLR_BIT (*(lcd->rs->port), lcd->rs->pin);
+  }
+}
+
+/**
+ * @desc    Write bytes, queued devices slot in every slot data bytes
+ *
+ * @param   struct st7735 *
+ * @param   const uint8_t * buffer
+ * @param   uint16_t length
+ *
+ * @return  void
+ */
+static void ST7735_SHARED_Write (struct st7735 * lcd, const uint8_t * buffer, uint16_t length)
+{
+  struct st7735_device * dev = lcd->bus_data;
+  struct st7735_shared * shared = dev->shared;
+  uint16_t size;
+
+  // loop through slots
+  while (length) {
+    size = length;
+    // reads, commands and whole writes are not split
+    if (shared->slot && !dev->reading && (dev->level == ST7735_DATA) && (size > shared->slot - dev->count)) {
+      size = shared->slot - dev->count;
+    }
+    shared->port->exchange (buffer, NULL, size);
+    buffer += size;
+    length -= size;
+    dev->count += size;
+    // slot used up, other devices waiting
+    if (shared->slot && !dev->reading && (dev->level == ST7735_DATA) && (dev->count >= shared->slot)) {
+      dev->count = 0;
+      if (ST7735_Shared_Next (shared) != NULL) {
+        ST7735_Shared_Run (shared, shared->slot);
+        // display continues where it stopped
+        ST7735_Shared_Acquire (shared, dev, lcd->clock);
+        ST7735_SHARED_Mode (lcd, dev->level);
+      }
+    }
+  }
+}
+
+/**
+ * @desc    Read bytes
+ *
+ * @param   struct st7735 *
+ * @param   uint8_t * buffer
+ * @param   uint16_t length
+ *
+ * @return  void
+ */
+static void ST7735_SHARED_Read (struct st7735 * lcd, uint8_t * buffer, uint16_t length)
+{
+  struct st7735_device * dev = lcd->bus_data;
+
+  dev->shared->port->exchange (NULL, buffer, length);
+}
+
+/** @const Display on shared bus */
+const struct st7735_bus ST7735_BUS_SHARED = {
+  .init   = ST7735_SHARED_Init,
+  .select = ST7735_SHARED_Select,
+  .mode   = ST7735_SHARED_Mode,
+  .reset  = ST7735_SHARED_Reset,
+  .write  = ST7735_SHARED_Write,
+  .fill   = NULL,
+  .read   = ST7735_SHARED_Read,
+  .pixels = NULL
+};
@@ -0,0 +1,175 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - shared SPI bus manager
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       19.10.2026
+ * @file        st7735_shared.h
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Manager owns SPI peripheral shared by displays and other devices (SD card,
+ *              flash, sensors). Each device has its chip select, clock step and SPI mode,
+ *              peripheral is reconfigured only when owner changes.
+ *
+ *              Displays use ST7735_BUS_SHARED (lcd->bus_data = struct st7735_device *).
+ *              Display keeps chip select low across commands and bursts until another
+ *              device takes the bus, so drawing is not broken by CS toggling per command.
+ *
+ *              Other devices queue transfers. Queues are served round robin at end of
+ *              each display transaction and between slot data bytes of long display
+ *              writes. Data bytes are counted from last command, so even slot splits
+ *              RAMWR stream at pixel boundary (pixel stream continues after CS is taken
+ *              back) and queued device waits at most slot display bytes. Transfers flagged ST7735_XFER_HOLD keep
+ *              chip select for next transfer of the same device; such batch is never
+ *              interrupted. ST7735_Shared_Run serves queues when no display draws.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include "st7735.h"
+
+#ifndef __ST7735_SHARED_H__
+#define __ST7735_SHARED_H__
+
+  // SPI mode of device, ored - bits of AVR SPCR
+  // -----------------------------------
+  #define ST7735_SPI_CPHA       0x04              // sample on trailing edge
+  #define ST7735_SPI_CPOL       0x08              // clock idle high
+  #define ST7735_SPI_LSB        0x20              // LSB first
+
+  // Transfer flags
+  // -----------------------------------
+  #define ST7735_XFER_COMMAND   0x01              // D/C low, devices with dc line
+  #define ST7735_XFER_HOLD      0x02              // keep chip select for next transfer
+
+  struct st7735_shared;
+
+  /** @struct Queued transfer, memory owned by caller till done */
+  struct st7735_transfer {
+    // bytes out; NULL = 0xFF clocked out
+    const uint8_t * tx;
+    // bytes in; NULL = dropped
+    uint8_t * rx;
+    // bytes
+    uint16_t length;
+    // ST7735_XFER_x ored
+    uint8_t flags;
+    // called when finished, may queue next transfer of batch; optional
+    void (*done) (struct st7735_transfer *);
+    // caller data
+    void * context;
+    // next in queue
+    struct st7735_transfer * next;
+  };
+
+  /** @struct Device on shared bus */
+  struct st7735_device {
+    // chip select
+    struct signal * cs;
+    // data / command of queued transfers; NULL = none
+    struct signal * dc;
+    // clock step, ST7735_CLOCK_STEPS; displays use lcd->clock / lcd->clock_read
+    uint8_t clock;
+    // ST7735_SPI_x ored, 0 = mode 0 MSB first
+    uint8_t mode;
+    // manager, set by attach
+    struct st7735_shared * shared;
+    // queue of transfers
+    struct st7735_transfer * head;
+    struct st7735_transfer * tail;
+    // display data bytes since last command or since queues were served
+    uint16_t count;
+    // display D/C level and read in progress
+    uint8_t level;
+    uint8_t reading;
+    // next attached device
+    struct st7735_device * next;
+  };
+
+  /** @struct SPI peripheral operations */
+  struct st7735_spi_port {
+    // clock step and ST7735_SPI_x mode
+    void (*setup) (uint8_t, uint8_t);
+    // full duplex bytes, tx NULL = 0xFF, rx NULL = dropped
+    void (*exchange) (const uint8_t *, uint8_t *, uint16_t);
+  };
+
+  /** @struct Shared bus */
+  struct st7735_shared {
+    // peripheral; NULL = ST7735_SPI_PORT on AVR
+    const struct st7735_spi_port * port;
+    // max bytes of display write before queued devices get the bus, even; 0 = whole writes
+    uint16_t slot;
+    // attached devices
+    struct st7735_device * devices;
+    // device with chip select low
+    struct st7735_device * owner;
+    // device served first by next round
+    struct st7735_device * turn;
+    // setup of peripheral, 0xFF = unknown
+    uint8_t clock;
+    uint8_t mode;
+  };
+
+#if defined(__AVR__)
+  /** @const AVR hardware SPI */
+  extern const struct st7735_spi_port ST7735_SPI_PORT;
+#endif
+
+  /** @const Display on shared bus */
+  extern const struct st7735_bus ST7735_BUS_SHARED;
+
+  /**
+   * @desc    Init shared bus
+   *
+   * @param   struct st7735_shared *
+   *
+   * @return  void
+   */
+  void ST7735_Shared_Init (struct st7735_shared *);
+
+  /**
+   * @desc    Attach device
+   *
+   * @param   struct st7735_shared *
+   * @param   struct st7735_device *
+   *
+   * @return  void
+   */
+  void ST7735_Shared_Attach (struct st7735_shared *, struct st7735_device *);
+
+  /**
+   * @desc    Queue transfer
+   *
+   * @param   struct st7735_device *
+   * @param   struct st7735_transfer *
+   *
+   * @return  void
+   */
+  void ST7735_Shared_Queue (struct st7735_device *, struct st7735_transfer *);
+
+  /**
+   * @desc    Serve queued transfers
+   *
+   * @param   struct st7735_shared *
+   * @param   uint16_t
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_Shared_Run (struct st7735_shared *, uint16_t);
+
+  /**
+   * @desc    Release chip select of owner
+   *
+   * @param   struct st7735_shared *
+   *
+   * @return  void
+   */
+  void ST7735_Shared_Release (struct st7735_shared *);
+
+#endif
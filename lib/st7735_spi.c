@@ -0,0 +1,373 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - AVR hardware SPI bus
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_spi.c
+ * @version     2.0
+ * @tested      not tested, AVR build not run
+ *
+ * @depend      st7735.h, st7735_bus.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Default bus on AVR. SPDR is reloaded as soon as SPIF is set, so SPI keeps
+ *              busy during bulk write and fill. Readback comes in on MISO (PB4); on modules
+ *              with single bidirectional SDA pin join MISO to MOSI over 1k resistor.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#if defined(__AVR__)
+
+#include "st7735_port.h"
+#include "st7735.h"
+
+// clock step set in SPCR / SPSR
+uint8_t ST7735_SPI_Step;
+
+/**
+ * @desc    Hardware Reset
+ *
+ * @param   struct signal *
+ *
+ * @return  void
+ */
+void ST7735_Reset (struct signal * reset)
+{
+  // Actiavte pull-up resistor logical high on pin RST
+  // posible write: SET_BIT (*(*reset).port, reset->pin)
+  SET_BIT (*(reset->port), reset->pin);
+  // DDR as output
+  SET_BIT (*(reset->ddr), reset->pin);
+  // delay 200 ms
+  _delay_ms(200);
+  // Reset Low 
+  CLR_BIT (*(reset->port), reset->pin);
+  // delay 200 ms
+  _delay_ms(200);
+  // Reset High
+  SET_BIT (*(reset->port), reset->pin);
+}
+
+/**
+ * @desc    Init SPI
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void ST7735_SPI_Init (void)
+{
+  // Output: SCK, MOSI 
+  SET_BIT (DDR, ST7735_SCK);
+  SET_BIT (DDR, ST7735_MOSI);
+  // Input: MISO with pullup
+  CLR_BIT (DDR, ST7735_MISO);
+  SET_BIT (PORT, ST7735_MISO);
+  // SPE  - SPI Enale
+  // MSTR - Master device
+  SET_BIT (SPCR, SPE);
+  SET_BIT (SPCR, MSTR);
+  // SPR1:0 cleared, SPI2X - Prescaler fclk/2 = 8MHz, also after other display changed step
+  SPCR &= ~((1 << SPR1) | (1 << SPR0));
+  SET_BIT (SPSR, SPI2X);
+  // clock step 0
+  ST7735_SPI_Step = 0;
+}
+
+/**
+ * @desc    Set clock step, fclk / 2^(step + 1)
+ *
+ * @param   uint8_t step - 0 = fclk/2 ... 6 = fclk/128
+ *
+ * @return  void
+ */
+void ST7735_SPI_Clock (uint8_t step)
+{
+  // already set
+  if (step == ST7735_SPI_Step) {
+    return;
+  }
+  ST7735_SPI_Step = step;
+  // SPR1:0 - fclk/4, /16, /64, /128
+  SPCR = (SPCR & ~((1 << SPR1) | (1 << SPR0))) | (step >> 1);
+  // SPI2X doubles even steps, fclk/128 has no doubled pair
+  if ((step & 1) || (step >= ST7735_CLOCK_STEPS - 1)) {
+    CLR_BIT (SPSR, SPI2X);
+  } else {
+    SET_BIT (SPSR, SPI2X);
+  }
+}
+
+/**
+ * @desc    Init Pins
+ *
+ * @param   struct st7735 *
+ *
+ * @return  void
+ */
+void ST7735_Pins_Init (struct st7735 * lcd)
+{
+  // DDR
+  // --------------------------------------
+  SET_BIT (*(lcd->cs->ddr), lcd->cs->pin);
+  SET_BIT (*(lcd->bl->ddr), lcd->bl->pin);
+  SET_BIT (*(lcd->dc->ddr), lcd->dc->pin);
+  // PORT
+  // --------------------------------------
+  SET_BIT (*(lcd->cs->port), lcd->cs->pin);   // Chip Select H
+  SET_BIT (*(lcd->bl->port), lcd->bl->pin);   // BackLigt ON
+}
+
+
+/**
+ * @desc    Init bus and control pins
+ *
+ * @param   struct st7735 *
+ *
+ * @return  void
+ */
+static void ST7735_SPI_BusInit (struct st7735 * lcd)
+{
+  // init pins
+  ST7735_Pins_Init (lcd);
+  // init SPI
+  ST7735_SPI_Init ();
+  // reset high, DDR as output
+  SET_BIT (*(lcd->rs->port), lcd->rs->pin);
+  SET_BIT (*(lcd->rs->ddr), lcd->rs->pin);
+}
+
+/**
+ * @desc    Chip select
+ *
+ * @param   struct st7735 *
+ * @param   uint8_t 1 = selected, 0 = released
+ *
+ * @return  void
+ */
+static void ST7735_SPI_Select (struct st7735 * lcd, uint8_t state)
+{
+  // chip select active low
+  if (state) {
+    // clock of this display, reads may need slower one
+    ST7735_SPI_Clock ((state == ST7735_SELECT_READ) ? lcd->clock_read : lcd->clock);
+    CLR_BIT (*(lcd->cs->port), lcd->cs->pin);
+  } else {
+    SET_BIT (*(lcd->cs->port), lcd->cs->pin);
+  }
+}
+
+/**
+ * @desc    Data / Command
+ *
+ * @param   struct st7735 *
+ * @param   uint8_t ST7735_DATA / ST7735_COMMAND
+ *
+ * @return  void
+ */
+static void ST7735_SPI_Mode (struct st7735 * lcd, uint8_t mode)
+{
+  // data high, command low
+  if (mode) {
+    SET_BIT (*(lcd->dc->port), lcd->dc->pin);
+  } else {
+    CLR_BIT (*(lcd->dc->port), lcd->dc->pin);
+  }
+}
+
+/**
+ * @desc    Reset line
+ *
+ * @param   struct st7735 *
+ * @param   uint8_t level
+ *
+ * @return  void
+ */
+static void ST7735_SPI_ResetLine (struct st7735 * lcd, uint8_t level)
+{
+  // reset active low
+  if (level) {
+    SET_BIT (*(lcd->rs->port), lcd->rs->pin);
+  } else {
+    CLR_BIT (*(lcd->rs->port), lcd->rs->pin);
+  }
+}
+
+/**
+ * @desc    Bulk write
+ *
+ * @param   struct st7735 *
+ * @param   const uint8_t * buffer
+ * @param   uint16_t length
+ *
+ * @return  void
+ */
+static void ST7735_SPI_Write (struct st7735 * lcd, const uint8_t * buffer, uint16_t length)
+{
+  uint8_t data;
+
+  // nothing to send
+  if (length == 0) {
+    return;
+  }
+  // first byte
+  SPDR = *buffer++;
+  // next bytes
+  while (--length) {
+    // load next byte while previous is transmitted
+    data = *buffer++;
+    // wait till data transmit
+    WAIT_UNTIL_BIT_IS_SET (SPSR, SPIF);
+    // transmitting data
+    SPDR = data;
+  }
+  // wait till last byte transmit
+  WAIT_UNTIL_BIT_IS_SET (SPSR, SPIF);
+}
+
+/**
+ * @desc    Repeat color
+ *
+ * @param   struct st7735 *
+ * @param   uint16_t color
+ * @param   uint16_t count
+ *
+ * @return  void
+ */
+static void ST7735_SPI_Fill (struct st7735 * lcd, uint16_t color, uint16_t count)
+{
+  uint8_t high = (uint8_t) (color >> 8);
+  uint8_t low = (uint8_t) (color);
+
+  // counter
+  while (count--) {
+    // transmitting data high byte
+    SPDR = high;
+    // wait till high byte transmit
+    WAIT_UNTIL_BIT_IS_SET (SPSR, SPIF);
+    // transmitting data low byte
+    SPDR = low;
+    // wait till low byte transmit
+    WAIT_UNTIL_BIT_IS_SET (SPSR, SPIF);
+  }
+}
+
+/**
+ * @desc    Stream array of pixels
+ *          next pixel is fetched while current byte is shifted out and loop
+ *          is unrolled to two pixels, so SPDR is reloaded right after SPIF
+ *
+ * @param   const uint16_t * pixels
+ * @param   uint16_t count - at least 1
+ * @param   uint8_t memory - ST7735_SRAM / ST7735_FLASH, constant after inline
+ *
+ * @return  void
+ */
+static inline __attribute__((always_inline)) void ST7735_SPI_Stream (const uint16_t * pixels, uint16_t count, uint8_t memory)
+{
+  uint16_t color;
+  uint16_t next;
+
+  // first pixel
+  color = (memory == ST7735_FLASH) ? pgm_read_word (pixels) : *pixels;
+  pixels++;
+  // transmitting high byte
+  SPDR = (uint8_t) (color >> 8);
+  // pixels left
+  count--;
+  // pairs of pixels
+  while (count >= 2) {
+    // fetch while high byte is transmitted
+    next = (memory == ST7735_FLASH) ? pgm_read_word (pixels) : *pixels;
+    WAIT_UNTIL_BIT_IS_SET (SPSR, SPIF);
+    SPDR = (uint8_t) (color);
+    WAIT_UNTIL_BIT_IS_SET (SPSR, SPIF);
+    SPDR = (uint8_t) (next >> 8);
+    // fetch while high byte is transmitted
+    color = (memory == ST7735_FLASH) ? pgm_read_word (pixels + 1) : *(pixels + 1);
+    WAIT_UNTIL_BIT_IS_SET (SPSR, SPIF);
+    SPDR = (uint8_t) (next);
+    WAIT_UNTIL_BIT_IS_SET (SPSR, SPIF);
+    SPDR = (uint8_t) (color >> 8);
+    // next pair
+    pixels += 2;
+    count -= 2;
+  }
+  // odd pixel
+  if (count) {
+    next = (memory == ST7735_FLASH) ? pgm_read_word (pixels) : *pixels;
+    WAIT_UNTIL_BIT_IS_SET (SPSR, SPIF);
+    SPDR = (uint8_t) (color);
+    WAIT_UNTIL_BIT_IS_SET (SPSR, SPIF);
+    SPDR = (uint8_t) (next >> 8);
+    color = next;
+  }
+  // low byte of last pixel
+  WAIT_UNTIL_BIT_IS_SET (SPSR, SPIF);
+  SPDR = (uint8_t) (color);
+  // wait till last byte transmit
+  WAIT_UNTIL_BIT_IS_SET (SPSR, SPIF);
+}
+
+/**
+ * @desc    Array of pixels
+ *
+ * @param   struct st7735 *
+ * @param   const uint16_t * pixels
+ * @param   uint16_t count
+ * @param   uint8_t memory - ST7735_SRAM / ST7735_FLASH
+ *
+ * @return  void
+ */
+static void ST7735_SPI_Pixels (struct st7735 * lcd, const uint16_t * pixels, uint16_t count, uint8_t memory)
+{
+  // nothing to send
+  if (count == 0) {
+    return;
+  }
+  // one loop per memory, no branch per pixel
+  if (memory == ST7735_FLASH) {
+    ST7735_SPI_Stream (pixels, count, ST7735_FLASH);
+  } else {
+    ST7735_SPI_Stream (pixels, count, ST7735_SRAM);
+  }
+}
+
+/**
+ * @desc    Bulk read
+ *
+ * @param   struct st7735 *
+ * @param   uint8_t * buffer
+ * @param   uint16_t length
+ *
+ * @return  void
+ */
+static void ST7735_SPI_Read (struct st7735 * lcd, uint8_t * buffer, uint16_t length)
+{
+  // counter
+  while (length--) {
+    // clock out dummy byte
+    SPDR = 0xFF;
+    // wait till byte received
+    WAIT_UNTIL_BIT_IS_SET (SPSR, SPIF);
+    // received byte
+    *buffer++ = SPDR;
+  }
+}
+
+/** @const AVR hardware SPI */
+const struct st7735_bus ST7735_BUS_SPI = {
+  .init   = ST7735_SPI_BusInit,
+  .select = ST7735_SPI_Select,
+  .mode   = ST7735_SPI_Mode,
+  .reset  = ST7735_SPI_ResetLine,
+  .write  = ST7735_SPI_Write,
+  .fill   = ST7735_SPI_Fill,
+  .read   = ST7735_SPI_Read,
+  .pixels = ST7735_SPI_Pixels
+};
+
+#endif
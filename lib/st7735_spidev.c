@@ -0,0 +1,407 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - Linux spidev bus
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_spidev.c
+ * @version     2.0
+ * @tested      Linux (make test)
+ *
+ * @depend      st7735.h, st7735_bus.h, linux/spi/spidev.h, linux/gpio.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Bulk transfers through SPI_IOC_MESSAGE, chip select driven by kernel.
+ *              D/C, RST and BL are lines of GPIO character device; line offsets are taken
+ *              from lcd->dc->pin, lcd->rs->pin and lcd->bl->pin (port pointers unused).
+ *
+ *              Node which is not a spidev device (FIFO, regular file, pty used as mock)
+ *              refuses ioctl with ENOTTY; bytes are then written by write(2), so whole
+ *              traffic can be captured and checked on host.
+ *
+ *              On open failure struct st7735_spidev.fd is -1 after ST7735_Init. Failed
+ *              open, ioctl, write or read keeps its errno in struct st7735_spidev.error
+ *              and drops rest of the transfer.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#if defined(__linux__)
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/gpio.h>
+#include <linux/spi/spidev.h>
+#include "st7735_port.h"
+#include "st7735.h"
+
+// Transfer size; default spidev bufsiz
+#define ST7735_SPIDEV_CHUNK   4096
+
+// Line indexes in request
+#define ST7735_SPIDEV_DC      0
+#define ST7735_SPIDEV_RS      1
+#define ST7735_SPIDEV_BL      2
+
+/**
+ * @desc    Keep errno of first failure
+ *
+ * @param   struct st7735_spidev *
+ *
+ * @return  void
+ */
+static void ST7735_SPIDEV_Error (struct st7735_spidev * bus)
+{
+  if (bus->error == 0) {
+    bus->error = errno;
+  }
+}
+
+/**
+ * @desc    Set gpio line
+ *
+ * @param   struct st7735_spidev *
+ * @param   uint8_t index of line
+ * @param   uint8_t level
+ *
+ * @return  void
+ */
+static void ST7735_SPIDEV_Line (struct st7735_spidev * bus, uint8_t index, uint8_t level)
+{
+  struct gpio_v2_line_values values;
+
+  // no lines
+  if (bus->lines < 0) {
+    return;
+  }
+  // level unchanged
+  if (((bus->levels >> index) & 1) == level) {
+    return;
+  }
+  // update cached levels
+  bus->levels ^= (1 << index);
+  // set line
+  values.mask = 1ULL << index;
+  values.bits = (uint64_t) level << index;
+  if (ioctl (bus->lines, GPIO_V2_LINE_SET_VALUES_IOCTL, &values) < 0) {
+    ST7735_SPIDEV_Error (bus);
+  }
+}
+
+/**
+ * @desc    Init bus and control pins
+ *
+ * @param   struct st7735 *
+ *
+ * @return  void
+ */
+static void ST7735_SPIDEV_Init (struct st7735 * lcd)
+{
+  struct st7735_spidev * bus = lcd->bus_data;
+  struct gpio_v2_line_request request;
+  uint8_t mode = SPI_MODE_0;
+  uint8_t bits = 8;
+  int chip;
+
+  // spi device
+  bus->fd = open (bus->device, O_RDWR);
+  bus->lines = -1;
+  bus->held = 0;
+  bus->error = 0;
+  // error
+  if (bus->fd < 0) {
+    ST7735_SPIDEV_Error (bus);
+    return;
+  }
+  // mode 0, 8 bits, clock - refused by mock node
+  ioctl (bus->fd, SPI_IOC_WR_MODE, &mode);
+  ioctl (bus->fd, SPI_IOC_WR_BITS_PER_WORD, &bits);
+  ioctl (bus->fd, SPI_IOC_WR_MAX_SPEED_HZ, &bus->speed);
+
+  // no gpio lines
+  if (bus->gpiochip == NULL) {
+    return;
+  }
+  // gpio chip
+  chip = open (bus->gpiochip, O_RDWR);
+  // error
+  if (chip < 0) {
+    ST7735_SPIDEV_Error (bus);
+    return;
+  }
+  // request D/C, RST, BL as outputs, all high
+  memset (&request, 0, sizeof (request));
+  request.offsets[ST7735_SPIDEV_DC] = lcd->dc->pin;
+  request.offsets[ST7735_SPIDEV_RS] = lcd->rs->pin;
+  request.num_lines = 2;
+  if (lcd->bl != NULL) {
+    request.offsets[ST7735_SPIDEV_BL] = lcd->bl->pin;
+    request.num_lines = 3;
+  }
+  request.config.flags = GPIO_V2_LINE_FLAG_OUTPUT;
+  request.config.num_attrs = 1;
+  request.config.attrs[0].attr.id = GPIO_V2_LINE_ATTR_ID_OUTPUT_VALUES;
+  request.config.attrs[0].attr.values = (1ULL << request.num_lines) - 1;
+  request.config.attrs[0].mask = (1ULL << request.num_lines) - 1;
+  strncpy (request.consumer, "st7735", sizeof (request.consumer) - 1);
+  // lines handle
+  if (ioctl (chip, GPIO_V2_GET_LINE_IOCTL, &request) == 0) {
+    bus->lines = request.fd;
+    bus->levels = (1 << request.num_lines) - 1;
+  } else {
+    ST7735_SPIDEV_Error (bus);
+  }
+  // chip not needed anymore
+  close (chip);
+}
+
+/**
+ * @desc    Chip select - driven by kernel per transfer, held across transfers only
+ *          for read, where command and data must share one selection
+ *
+ * @param   struct st7735 *
+ * @param   uint8_t 1 = selected, 0 = released, ST7735_SELECT_READ = held
+ *
+ * @return  void
+ */
+static void ST7735_SPIDEV_Select (struct st7735 * lcd, uint8_t state)
+{
+  struct st7735_spidev * bus = lcd->bus_data;
+  struct spi_ioc_transfer transfer;
+
+  // keep selected after each transfer
+  if (state == ST7735_SELECT_READ) {
+    bus->held = 1;
+    return;
+  }
+  // release held chip select by empty transfer
+  if ((state == 0) && bus->held) {
+    bus->held = 0;
+    memset (&transfer, 0, sizeof (transfer));
+    transfer.speed_hz = bus->speed >> lcd->clock_read;
+    transfer.bits_per_word = 8;
+    if ((ioctl (bus->fd, SPI_IOC_MESSAGE (1), &transfer) < 0) && (errno != ENOTTY) && (errno != EINVAL)) {
+      ST7735_SPIDEV_Error (bus);
+    }
+  }
+}
+
+/**
+ * @desc    Data / Command
+ *
+ * @param   struct st7735 *
+ * @param   uint8_t ST7735_DATA / ST7735_COMMAND
+ *
+ * @return  void
+ */
+static void ST7735_SPIDEV_Mode (struct st7735 * lcd, uint8_t mode)
+{
+  ST7735_SPIDEV_Line (lcd->bus_data, ST7735_SPIDEV_DC, mode ? 1 : 0);
+}
+
+/**
+ * @desc    Reset line
+ *
+ * @param   struct st7735 *
+ * @param   uint8_t level
+ *
+ * @return  void
+ */
+static void ST7735_SPIDEV_ResetLine (struct st7735 * lcd, uint8_t level)
+{
+  ST7735_SPIDEV_Line (lcd->bus_data, ST7735_SPIDEV_RS, level ? 1 : 0);
+}
+
+/**
+ * @desc    Bulk write
+ *
+ * @param   struct st7735 *
+ * @param   const uint8_t * buffer
+ * @param   uint16_t length
+ *
+ * @return  void
+ */
+static void ST7735_SPIDEV_Write (struct st7735 * lcd, const uint8_t * buffer, uint16_t length)
+{
+  struct st7735_spidev * bus = lcd->bus_data;
+  struct spi_ioc_transfer transfer;
+  uint16_t size;
+  ssize_t count;
+
+  // not opened
+  if (bus->fd < 0) {
+    return;
+  }
+  // loop through chunks
+  while (length) {
+    // chunk size
+    size = (length > ST7735_SPIDEV_CHUNK) ? ST7735_SPIDEV_CHUNK : length;
+    // one transfer per chunk
+    memset (&transfer, 0, sizeof (transfer));
+    transfer.tx_buf = (uintptr_t) buffer;
+    transfer.len = size;
+    // command of held read goes at read clock
+    transfer.speed_hz = bus->speed >> (bus->held ? lcd->clock_read : lcd->clock);
+    transfer.bits_per_word = 8;
+    transfer.cs_change = bus->held;
+    // sent
+    if (ioctl (bus->fd, SPI_IOC_MESSAGE (1), &transfer) >= 0) {
+      count = size;
+    // not a spidev node - mock device, plain write may be partial
+    } else if ((errno == ENOTTY) || (errno == EINVAL)) {
+      count = write (bus->fd, buffer, size);
+    } else {
+      count = -1;
+    }
+    // failed, rest dropped
+    if (count <= 0) {
+      ST7735_SPIDEV_Error (bus);
+      return;
+    }
+    size = count;
+    // next chunk
+    buffer += size;
+    length -= size;
+  }
+}
+
+/**
+ * @desc    Repeat color
+ *
+ * @param   struct st7735 *
+ * @param   uint16_t color
+ * @param   uint16_t count
+ *
+ * @return  void
+ */
+static void ST7735_SPIDEV_Fill (struct st7735 * lcd, uint16_t color, uint16_t count)
+{
+  uint8_t buffer[ST7735_SPIDEV_CHUNK];
+  uint16_t pixels = (count > (ST7735_SPIDEV_CHUNK >> 1)) ? (ST7735_SPIDEV_CHUNK >> 1) : count;
+  uint16_t length;
+  uint16_t i;
+
+  // expand color, high byte first
+  for (i = 0; i < pixels; i++) {
+    buffer[(i << 1)] = (uint8_t) (color >> 8);
+    buffer[(i << 1) + 1] = (uint8_t) (color);
+  }
+  // send chunks
+  while (count) {
+    // pixels in this chunk
+    length = (count > pixels) ? pixels : count;
+    // bulk transfer
+    ST7735_SPIDEV_Write (lcd, buffer, length << 1);
+    // update counter
+    count -= length;
+  }
+}
+
+/**
+ * @desc    Array of pixels
+ *
+ * @param   struct st7735 *
+ * @param   const uint16_t * pixels
+ * @param   uint16_t count
+ * @param   uint8_t memory - flash is ordinary memory
+ *
+ * @return  void
+ */
+static void ST7735_SPIDEV_Pixels (struct st7735 * lcd, const uint16_t * pixels, uint16_t count, uint8_t memory)
+{
+  uint8_t buffer[ST7735_SPIDEV_CHUNK];
+  uint16_t length;
+  uint16_t i;
+
+  // send chunks
+  while (count) {
+    // pixels in this chunk
+    length = (count > (ST7735_SPIDEV_CHUNK >> 1)) ? (ST7735_SPIDEV_CHUNK >> 1) : count;
+    // swap, high byte first
+    for (i = 0; i < length; i++) {
+      buffer[(i << 1)] = (uint8_t) (pixels[i] >> 8);
+      buffer[(i << 1) + 1] = (uint8_t) (pixels[i]);
+    }
+    // bulk transfer
+    ST7735_SPIDEV_Write (lcd, buffer, length << 1);
+    // update counter
+    pixels += length;
+    count -= length;
+  }
+}
+
+/**
+ * @desc    Bulk read
+ *
+ * @param   struct st7735 *
+ * @param   uint8_t * buffer
+ * @param   uint16_t length
+ *
+ * @return  void
+ */
+static void ST7735_SPIDEV_Read (struct st7735 * lcd, uint8_t * buffer, uint16_t length)
+{
+  struct st7735_spidev * bus = lcd->bus_data;
+  struct spi_ioc_transfer transfer;
+  uint16_t size;
+  ssize_t count;
+
+  // nothing received
+  memset (buffer, 0, length);
+  // not opened
+  if (bus->fd < 0) {
+    return;
+  }
+  // loop through chunks
+  while (length) {
+    // chunk size
+    size = (length > ST7735_SPIDEV_CHUNK) ? ST7735_SPIDEV_CHUNK : length;
+    // one transfer per chunk, zeros sent
+    memset (&transfer, 0, sizeof (transfer));
+    transfer.rx_buf = (uintptr_t) buffer;
+    transfer.len = size;
+    transfer.speed_hz = bus->speed >> lcd->clock_read;
+    transfer.bits_per_word = 8;
+    transfer.cs_change = bus->held;
+    // sent
+    if (ioctl (bus->fd, SPI_IOC_MESSAGE (1), &transfer) >= 0) {
+      count = size;
+    // not a spidev node - mock device, plain read
+    } else if ((errno == ENOTTY) || (errno == EINVAL)) {
+      count = read (bus->fd, buffer, size);
+      // end of mock data, rest stays zero
+      if (count == 0) {
+        return;
+      }
+    } else {
+      count = -1;
+    }
+    // failed, rest stays zero
+    if (count < 0) {
+      ST7735_SPIDEV_Error (bus);
+      return;
+    }
+    size = count;
+    // next chunk
+    buffer += size;
+    length -= size;
+  }
+}
+
+/** @const Linux spidev */
+const struct st7735_bus ST7735_BUS_SPIDEV = {
+  .init   = ST7735_SPIDEV_Init,
+  .select = ST7735_SPIDEV_Select,
+  .mode   = ST7735_SPIDEV_Mode,
+  .reset  = ST7735_SPIDEV_ResetLine,
+  .write  = ST7735_SPIDEV_Write,
+  .fill   = ST7735_SPIDEV_Fill,
+  .read   = ST7735_SPIDEV_Read,
+  .pixels = ST7735_SPIDEV_Pixels
+};
+
+#endif
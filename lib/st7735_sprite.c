@@ -0,0 +1,339 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - sprites with save-under
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_sprite.c
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735_sprite.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Old and new position of moved sprite overlap in one rectangle, rest of each
+ *              is at most one vertical and one horizontal strip. Save-under buffer is shifted
+ *              in place by overlap, so only strips go over bus.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include <stdlib.h>
+#include "st7735_port.h"
+#include "st7735_sprite.h"
+
+/**
+ * @desc    Background pixel under sprite
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_sprite *
+ * @param   uint8_t x
+ * @param   uint8_t y
+ *
+ * @return  uint16_t
+ */
+static uint16_t ST7735_Sprite_Under (struct st7735 * lcd, const struct st7735_sprite * sprite, uint8_t x, uint8_t y)
+{
+  // saved
+  if (sprite->under != NULL) {
+    return sprite->under[(y - sprite->y) * sprite->width + (x - sprite->x)];
+  }
+  // recomputed
+  return sprite->background (lcd, x, y);
+}
+
+/**
+ * @desc    Strips of rectangle a not covered by rectangle b of same size
+ *
+ * @param   struct st7735_sprite * - size
+ * @param   uint8_t x of a
+ * @param   uint8_t y of a
+ * @param   uint8_t x of b
+ * @param   uint8_t y of b
+ * @param   struct window strips[2]
+ *
+ * @return  uint8_t - number of strips
+ */
+static uint8_t ST7735_Sprite_Strips (const struct st7735_sprite * sprite, uint8_t ax, uint8_t ay, uint8_t bx, uint8_t by, struct window * strips)
+{
+  uint8_t count = 0;
+
+  // disjoint - whole a
+  if ((abs (ax - bx) >= sprite->width) || (abs (ay - by) >= sprite->height)) {
+    strips[0].x0 = ax;
+    strips[0].x1 = ax + sprite->width - 1;
+    strips[0].y0 = ay;
+    strips[0].y1 = ay + sprite->height - 1;
+    return 1;
+  }
+  // vertical strip, full height of a
+  if (ax != bx) {
+    strips[count].x0 = (bx > ax) ? ax : bx + sprite->width;
+    strips[count].x1 = (bx > ax) ? bx - 1 : ax + sprite->width - 1;
+    strips[count].y0 = ay;
+    strips[count].y1 = ay + sprite->height - 1;
+    count++;
+  }
+  // horizontal strip, columns shared with b
+  if (ay != by) {
+    strips[count].x0 = (bx > ax) ? bx : ax;
+    strips[count].x1 = ((bx > ax) ? ax : bx) + sprite->width - 1;
+    strips[count].y0 = (by > ay) ? ay : by + sprite->height;
+    strips[count].y1 = (by > ay) ? by - 1 : ay + sprite->height - 1;
+    count++;
+  }
+  // strips
+  return count;
+}
+
+/**
+ * @desc    Restore background of window
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_sprite *
+ * @param   struct window *
+ *
+ * @return  void
+ */
+static void ST7735_Sprite_Restore (struct st7735 * lcd, const struct st7735_sprite * sprite, const struct window * win)
+{
+  struct st7735_burst burst;
+  uint8_t x;
+  uint8_t y;
+
+  ST7735_Burst_Begin (lcd, &burst, win->x0, win->x1, win->y0, win->y1);
+  // loop through rows
+  for (y = win->y0; y <= win->y1; y++) {
+    // loop through columns
+    for (x = win->x0; x <= win->x1; x++) {
+      ST7735_Burst_Push (lcd, &burst, ST7735_Sprite_Under (lcd, sprite, x, y));
+    }
+  }
+  ST7735_Burst_End (lcd, &burst);
+}
+
+/**
+ * @desc    Save background of window into save-under buffer
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_sprite *
+ * @param   struct window *
+ *
+ * @return  uint8_t
+ */
+static uint8_t ST7735_Sprite_Save (struct st7735 * lcd, struct st7735_sprite * sprite, const struct window * win)
+{
+  uint16_t * row;
+  uint8_t y;
+
+  // background callback
+  if (sprite->under == NULL) {
+    return ST7735_SUCCESS;
+  }
+  // first row of window in buffer
+  row = &sprite->under[(win->y0 - sprite->y) * sprite->width + (win->x0 - sprite->x)];
+  // full rows - one read
+  if ((win->x1 - win->x0 + 1) == sprite->width) {
+    return ST7735_ReadWindow (lcd, win->x0, win->x1, win->y0, win->y1, row);
+  }
+  // loop through rows
+  for (y = win->y0; y <= win->y1; y++, row += sprite->width) {
+    if (ST7735_ReadWindow (lcd, win->x0, win->x1, y, y, row) == ST7735_ERROR) {
+      return ST7735_ERROR;
+    }
+  }
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Shift save-under buffer by move, overlap is kept
+ *
+ * @param   struct st7735_sprite *
+ * @param   uint8_t new x
+ * @param   uint8_t new y
+ *
+ * @return  void
+ */
+static void ST7735_Sprite_Shift (struct st7735_sprite * sprite, uint8_t x, uint8_t y)
+{
+  int16_t dx = x - sprite->x;
+  int16_t dy = y - sprite->y;
+  // overlap in coordinates of new buffer
+  int16_t c0 = (dx > 0) ? 0 : -dx;
+  int16_t c1 = (dx > 0) ? sprite->width - 1 - dx : sprite->width - 1;
+  int16_t r0 = (dy > 0) ? 0 : -dy;
+  int16_t r1 = (dy > 0) ? sprite->height - 1 - dy : sprite->height - 1;
+  // source is ahead of destination by offset
+  int16_t offset = dy * sprite->width + dx;
+  int16_t c, r;
+
+  // source ahead - forward
+  if (offset > 0) {
+    for (r = r0; r <= r1; r++) {
+      for (c = c0; c <= c1; c++) {
+        sprite->under[r * sprite->width + c] = sprite->under[r * sprite->width + c + offset];
+      }
+    }
+  // source behind - backward
+  } else {
+    for (r = r1; r >= r0; r--) {
+      for (c = c1; c >= c0; c--) {
+        sprite->under[r * sprite->width + c] = sprite->under[r * sprite->width + c + offset];
+      }
+    }
+  }
+}
+
+/**
+ * @desc    Draw sprite over background in one burst
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_sprite *
+ *
+ * @return  void
+ */
+static void ST7735_Sprite_Draw (struct st7735 * lcd, const struct st7735_sprite * sprite)
+{
+  struct window win = {
+    .x0 = sprite->x, .x1 = sprite->x + sprite->width - 1,
+    .y0 = sprite->y, .y1 = sprite->y + sprite->height - 1
+  };
+  struct st7735_burst burst;
+  const uint16_t * image = sprite->image;
+  uint16_t color;
+  uint8_t x;
+  uint8_t y;
+
+  ST7735_Burst_Begin (lcd, &burst, win.x0, win.x1, win.y0, win.y1);
+  // loop through rows
+  for (y = win.y0; y <= win.y1; y++) {
+    // loop through columns
+    for (x = win.x0; x <= win.x1; x++) {
+      // read from ROM memory
+      color = pgm_read_word (image++);
+      // transparent - background shows through
+      if (sprite->keyed && (color == sprite->key)) {
+        color = ST7735_Sprite_Under (lcd, sprite, x, y);
+      }
+      ST7735_Burst_Push (lcd, &burst, color);
+    }
+  }
+  ST7735_Burst_End (lcd, &burst);
+}
+
+/**
+ * @desc    Save background and draw sprite
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_sprite *
+ * @param   uint8_t x - left top corner
+ * @param   uint8_t y - left top corner
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7735_Sprite_Show (struct st7735 * lcd, struct st7735_sprite * sprite, uint8_t x, uint8_t y)
+{
+  struct window win = { .x0 = x, .x1 = x + sprite->width - 1, .y0 = y, .y1 = y + sprite->height - 1 };
+
+  // check if sprite is out of screen
+  if (((x + sprite->width) > lcd->width) || ((y + sprite->height) > lcd->height)) {
+    return ST7735_ERROR;
+  }
+  // already drawn
+  if (sprite->visible) {
+    return ST7735_Sprite_Move (lcd, sprite, x, y);
+  }
+  // position
+  sprite->x = x;
+  sprite->y = y;
+  // save whole background
+  if (ST7735_Sprite_Save (lcd, sprite, &win) == ST7735_ERROR) {
+    return ST7735_ERROR;
+  }
+  // draw
+  ST7735_Sprite_Draw (lcd, sprite);
+  sprite->visible = 1;
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Move sprite, restore exposed strips only
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_sprite *
+ * @param   uint8_t x - left top corner
+ * @param   uint8_t y - left top corner
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7735_Sprite_Move (struct st7735 * lcd, struct st7735_sprite * sprite, uint8_t x, uint8_t y)
+{
+  struct window strips[2];
+  uint8_t count;
+  uint8_t ox = sprite->x;
+  uint8_t oy = sprite->y;
+  uint8_t i;
+
+  // not drawn yet
+  if (!sprite->visible) {
+    return ST7735_Sprite_Show (lcd, sprite, x, y);
+  }
+  // check if sprite is out of screen
+  if (((x + sprite->width) > lcd->width) || ((y + sprite->height) > lcd->height)) {
+    return ST7735_ERROR;
+  }
+  // not moved
+  if ((x == ox) && (y == oy)) {
+    return ST7735_SUCCESS;
+  }
+  // restore strips of old position not covered by new one
+  count = ST7735_Sprite_Strips (sprite, ox, oy, x, y, strips);
+  for (i = 0; i < count; i++) {
+    ST7735_Sprite_Restore (lcd, sprite, &strips[i]);
+  }
+  // keep background of overlap
+  if ((sprite->under != NULL) && (abs (x - ox) < sprite->width) && (abs (y - oy) < sprite->height)) {
+    ST7735_Sprite_Shift (sprite, x, y);
+  }
+  // new position
+  sprite->x = x;
+  sprite->y = y;
+  // save strips of new position not covered by old one
+  count = ST7735_Sprite_Strips (sprite, x, y, ox, oy, strips);
+  for (i = 0; i < count; i++) {
+    if (ST7735_Sprite_Save (lcd, sprite, &strips[i]) == ST7735_ERROR) {
+      return ST7735_ERROR;
+    }
+  }
+  // draw
+  ST7735_Sprite_Draw (lcd, sprite);
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Restore background under sprite
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_sprite *
+ *
+ * @return  void
+ */
+void ST7735_Sprite_Hide (struct st7735 * lcd, struct st7735_sprite * sprite)
+{
+  struct window win = {
+    .x0 = sprite->x, .x1 = sprite->x + sprite->width - 1,
+    .y0 = sprite->y, .y1 = sprite->y + sprite->height - 1
+  };
+
+  // not drawn
+  if (!sprite->visible) {
+    return;
+  }
+  // whole background
+  ST7735_Sprite_Restore (lcd, sprite, &win);
+  sprite->visible = 0;
+}
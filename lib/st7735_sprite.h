@@ -0,0 +1,84 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - sprites with save-under
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_sprite.h
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Background under sprite comes either from save-under buffer (width x height
+ *              pixels, filled by ST7735_ReadWindow - needs MISO or framebuffer) or from
+ *              background callback when under is NULL. Move restores only strips of old
+ *              position which new one does not cover, reads only newly covered strips and
+ *              draws sprite in one window burst. Sprite must lie inside screen.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include "st7735.h"
+
+#ifndef __ST7735_SPRITE_H__
+#define __ST7735_SPRITE_H__
+
+  /** @struct Sprite */
+  struct st7735_sprite {
+    // image in flash, 565 pixels row by row
+    const uint16_t * image;
+    // size
+    uint8_t width;
+    uint8_t height;
+    // transparent color if keyed
+    uint16_t key;
+    uint8_t keyed;
+    // save-under buffer width x height pixels; NULL = background callback
+    uint16_t * under;
+    // background pixel at x, y when under is NULL
+    uint16_t (*background) (struct st7735 *, uint8_t, uint8_t);
+    // position of left top corner
+    uint8_t x;
+    uint8_t y;
+    // drawn on display
+    uint8_t visible;
+  };
+
+  /**
+   * @desc    Save background and draw sprite
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_sprite *
+   * @param   uint8_t
+   * @param   uint8_t
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_Sprite_Show (struct st7735 *, struct st7735_sprite *, uint8_t, uint8_t);
+
+  /**
+   * @desc    Move sprite, restore exposed strips only
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_sprite *
+   * @param   uint8_t
+   * @param   uint8_t
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_Sprite_Move (struct st7735 *, struct st7735_sprite *, uint8_t, uint8_t);
+
+  /**
+   * @desc    Restore background under sprite
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_sprite *
+   *
+   * @return  void
+   */
+  void ST7735_Sprite_Hide (struct st7735 *, struct st7735_sprite *);
+
+#endif
@@ -0,0 +1,191 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - compile-time pin specialisation
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_static.h
+ * @version     2.0
+ * @tested      not tested, AVR build not run
+ *
+ * @depend      st7735.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Generates driver hot paths with CS and D/C pins fixed at compile time. Port
+ *              and pin are constants, so every toggle compiles into single sbi / cbi
+ *              instruction instead of pointer-indirect load-modify-store. Chip select
+ *              stays low for the whole burst.
+ *
+ *              Usage (one line per display, at file scope):
+ *
+ *                ST7735_STATIC_DRIVER (LCD1, PORTB, 2, PORTB, 0)
+ *
+ *              generates LCD1_CommandSend, LCD1_Data8BitsSend, LCD1_Data16BitsSend,
+ *              LCD1_SetWindow, LCD1_SendColor565, LCD1_DrawPixel and LCD1_FillWindow.
+ *              Functions keep struct st7735 * argument for state (clip rectangle, write
+ *              clock lcd->clock set by ST7735_Calibrate), so they mix freely with runtime
+ *              API ST7735_Init, ST7735_DrawString, ... Generated functions only write,
+ *              lcd->clock_read is used by runtime API reads.
+ *
+ *              Fast path is taken only for display on ST7735_BUS_SPI without framebuffer;
+ *              display on other bus (ST7735_BUS_SHARED, bit-bang) or with framebuffer, and
+ *              every call with -DST7735_STATS, goes through runtime API of the same name,
+ *              so bus manager, framebuffer and counters see all traffic. Windows are
+ *              checked against width / height as by ST7735_SetWindow, DrawPixel and
+ *              FillWindow clip as runtime ones.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include <avr/io.h>
+#include "st7735.h"
+
+#ifndef __ST7735_STATIC_H__
+#define __ST7735_STATIC_H__
+
+  // FUNCTION macros
+  // -----------------------------------
+  // send one byte, wait till transmit
+  #define ST7735_STATIC_SPI(data)           { SPDR = (data); WAIT_UNTIL_BIT_IS_SET (SPSR, SPIF); }
+  // display needs runtime API; bus is set by ST7735_Init, one compare per call
+#if defined(ST7735_STATS)
+  #define ST7735_STATIC_RUNTIME(lcd)        1
+#elif defined(ST7735_FRAMEBUFFER)
+  #define ST7735_STATIC_RUNTIME(lcd)        (((lcd)->bus != &ST7735_BUS_SPI) || ((lcd)->fb != NULL))
+#else
+  #define ST7735_STATIC_RUNTIME(lcd)        ((lcd)->bus != &ST7735_BUS_SPI)
+#endif
+  // clock of display, call only on change; chip select low
+  #define ST7735_STATIC_SELECT(lcd, port, pin) { if (ST7735_SPI_Step != (lcd)->clock) ST7735_SPI_Clock ((lcd)->clock); CLR_BIT (port, pin); }
+
+  /**
+   * @desc    Generate display driver with constant CS, D/C pins
+   *
+   * @param   name     - prefix of generated functions
+   * @param   cs_port  - chip select port, e.g. PORTB
+   * @param   cs_pin   - chip select pin
+   * @param   dc_port  - data / command port, e.g. PORTB
+   * @param   dc_pin   - data / command pin
+   */
+  #define ST7735_STATIC_DRIVER(name, cs_port, cs_pin, dc_port, dc_pin)                              \
+                                                                                                    \
+    static inline uint8_t name##_CommandSend (struct st7735 * lcd, uint8_t data)                    \
+    {                                                                                               \
+      if (ST7735_STATIC_RUNTIME (lcd)) {                                                            \
+        return ST7735_CommandSend (lcd, data);                                                      \
+      }                                                                                             \
+      ST7735_STATIC_SELECT (lcd, cs_port, cs_pin);                                                  \
+      CLR_BIT (dc_port, dc_pin);                                                                    \
+      ST7735_STATIC_SPI (data);                                                                     \
+      SET_BIT (cs_port, cs_pin);                                                                    \
+      return SPDR;                                                                                  \
+    }                                                                                               \
+                                                                                                    \
+    static inline uint8_t name##_Data8BitsSend (struct st7735 * lcd, uint8_t data)                  \
+    {                                                                                               \
+      if (ST7735_STATIC_RUNTIME (lcd)) {                                                            \
+        return ST7735_Data8BitsSend (lcd, data);                                                    \
+      }                                                                                             \
+      ST7735_STATIC_SELECT (lcd, cs_port, cs_pin);                                                  \
+      SET_BIT (dc_port, dc_pin);                                                                    \
+      ST7735_STATIC_SPI (data);                                                                     \
+      SET_BIT (cs_port, cs_pin);                                                                    \
+      return SPDR;                                                                                  \
+    }                                                                                               \
+                                                                                                    \
+    static inline uint8_t name##_Data16BitsSend (struct st7735 * lcd, uint16_t data)                \
+    {                                                                                               \
+      if (ST7735_STATIC_RUNTIME (lcd)) {                                                            \
+        return ST7735_Data16BitsSend (lcd, data);                                                   \
+      }                                                                                             \
+      ST7735_STATIC_SELECT (lcd, cs_port, cs_pin);                                                  \
+      SET_BIT (dc_port, dc_pin);                                                                    \
+      ST7735_STATIC_SPI ((uint8_t) (data >> 8));                                                    \
+      ST7735_STATIC_SPI ((uint8_t) (data));                                                         \
+      SET_BIT (cs_port, cs_pin);                                                                    \
+      return SPDR;                                                                                  \
+    }                                                                                               \
+                                                                                                    \
+    static inline uint8_t name##_SetWindow (struct st7735 * lcd,                                    \
+                                            uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1)         \
+    {                                                                                               \
+      if (ST7735_STATIC_RUNTIME (lcd)) {                                                            \
+        return ST7735_SetWindow (lcd, x0, x1, y0, y1);                                              \
+      }                                                                                             \
+      if ((x0 > x1) || (x1 >= lcd->width) || (y0 > y1) || (y1 >= lcd->height)) {                    \
+        return ST7735_ERROR;                                                                        \
+      }                                                                                             \
+      ST7735_STATIC_SELECT (lcd, cs_port, cs_pin);                                                  \
+      CLR_BIT (dc_port, dc_pin);                                                                    \
+      ST7735_STATIC_SPI (CASET);                                                                    \
+      SET_BIT (dc_port, dc_pin);                                                                    \
+      ST7735_STATIC_SPI (0x00);                                                                     \
+      ST7735_STATIC_SPI (x0);                                                                       \
+      ST7735_STATIC_SPI (0x00);                                                                     \
+      ST7735_STATIC_SPI (x1);                                                                       \
+      CLR_BIT (dc_port, dc_pin);                                                                    \
+      ST7735_STATIC_SPI (RASET);                                                                    \
+      SET_BIT (dc_port, dc_pin);                                                                    \
+      ST7735_STATIC_SPI (0x00);                                                                     \
+      ST7735_STATIC_SPI (y0);                                                                       \
+      ST7735_STATIC_SPI (0x00);                                                                     \
+      ST7735_STATIC_SPI (y1);                                                                       \
+      SET_BIT (cs_port, cs_pin);                                                                    \
+      return ST7735_SUCCESS;                                                                        \
+    }                                                                                               \
+                                                                                                    \
+    static inline void name##_SendColor565 (struct st7735 * lcd, uint16_t color, uint16_t count)    \
+    {                                                                                               \
+      uint8_t high = (uint8_t) (color >> 8);                                                        \
+      uint8_t low = (uint8_t) (color);                                                              \
+      if (ST7735_STATIC_RUNTIME (lcd)) {                                                            \
+        ST7735_SendColor565 (lcd, color, count);                                                    \
+        return;                                                                                     \
+      }                                                                                             \
+      ST7735_STATIC_SELECT (lcd, cs_port, cs_pin);                                                  \
+      CLR_BIT (dc_port, dc_pin);                                                                    \
+      ST7735_STATIC_SPI (RAMWR);                                                                    \
+      SET_BIT (dc_port, dc_pin);                                                                    \
+      while (count--) {                                                                             \
+        ST7735_STATIC_SPI (high);                                                                   \
+        ST7735_STATIC_SPI (low);                                                                    \
+      }                                                                                             \
+      SET_BIT (cs_port, cs_pin);                                                                    \
+    }                                                                                               \
+                                                                                                    \
+    static inline void name##_DrawPixel (struct st7735 * lcd, uint8_t x, uint8_t y, uint16_t color) \
+    {                                                                                               \
+      if (ST7735_STATIC_RUNTIME (lcd)) {                                                            \
+        ST7735_DrawPixel (lcd, x, y, color);                                                        \
+        return;                                                                                     \
+      }                                                                                             \
+      if ((x < lcd->clip.x0) || (x > lcd->clip.x1) ||                                               \
+          (y < lcd->clip.y0) || (y > lcd->clip.y1)) {                                               \
+        return;                                                                                     \
+      }                                                                                             \
+      if (name##_SetWindow (lcd, x, x, y, y) == ST7735_ERROR) {                                     \
+        return;                                                                                     \
+      }                                                                                             \
+      name##_SendColor565 (lcd, color, 1);                                                          \
+    }                                                                                               \
+                                                                                                    \
+    static inline void name##_FillWindow (struct st7735 * lcd,                                      \
+                                          uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1,           \
+                                          uint16_t color)                                           \
+    {                                                                                               \
+      struct window win = { .x0 = x0, .x1 = x1, .y0 = y0, .y1 = y1 };                               \
+      if (ST7735_STATIC_RUNTIME (lcd)) {                                                            \
+        ST7735_FillWindow (lcd, x0, x1, y0, y1, color);                                             \
+        return;                                                                                     \
+      }                                                                                             \
+      if (ST7735_ClipWindow (lcd, &win) == ST7735_ERROR) {                                          \
+        return;                                                                                     \
+      }                                                                                             \
+      if (name##_SetWindow (lcd, win.x0, win.x1, win.y0, win.y1) == ST7735_ERROR) {                 \
+        return;                                                                                     \
+      }                                                                                             \
+      name##_SendColor565 (lcd, color, (uint16_t) (win.x1 - win.x0 + 1) * (win.y1 - win.y0 + 1));   \
+    }
+
+#endif
@@ -0,0 +1,124 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - instrumentation
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_stats.c
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735_stats.h
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include <string.h>
+#include "st7735_stats.h"
+
+#if defined(ST7735_STATS)
+
+#if !defined(__AVR__)
+  #include <time.h>
+#endif
+
+// Length of counter name
+#define ST7735_STATS_NAME     16
+
+/** @array Names of counters */
+static const char ST7735_STATS_NAMES[ST7735_STATS_COUNT + 3][ST7735_STATS_NAME] PROGMEM = {
+  "CommandSend",
+  "DataSend",
+  "Data8BitsSend",
+  "Data16BitsSend",
+  "SetWindow",
+  "SendColor565",
+  "FillWindow",
+  "DrawPixel",
+  "ClearScreen",
+  "DrawChar",
+  "DrawString",
+  "DrawLine",
+  "DrawLineHoriz",
+  "DrawLineVert",
+  "DrawRectangle",
+  "ReadWindow",
+  "WritePixels",
+  // totals
+  "command bytes",
+  "data bytes",
+  "cs toggles"
+};
+
+/** @var Statistics of all displays */
+struct st7735_stats st7735_stats;
+
+/**
+ * @desc    Read tick counter
+ *
+ * @param   void
+ *
+ * @return  uint16_t
+ */
+uint16_t ST7735_Stats_Tick (void)
+{
+#if defined(__AVR__)
+  // Timer1 counter
+  return TCNT1;
+#else
+  struct timespec now;
+  // microseconds
+  clock_gettime (CLOCK_MONOTONIC, &now);
+  return (uint16_t) (now.tv_sec * 1000000UL + now.tv_nsec / 1000);
+#endif
+}
+
+/**
+ * @desc    Clear counters and start Timer1
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void ST7735_Stats_Reset (void)
+{
+  // clear counters
+  memset (&st7735_stats, 0, sizeof (st7735_stats));
+#if defined(__AVR__)
+  // normal mode, free running
+  TCCR1A = 0;
+  TCCR1B = ST7735_STATS_CLOCK;
+#endif
+}
+
+/**
+ * @desc    Dump counters
+ *
+ * @param   void (*) (const char * name, uint32_t calls, uint32_t ticks)
+ *
+ * @return  void
+ */
+void ST7735_Stats_Dump (void (*print) (const char *, uint32_t, uint32_t))
+{
+  char name[ST7735_STATS_NAME];
+  uint8_t i;
+
+  // loop through entry points
+  for (i = 0; i < ST7735_STATS_COUNT; i++) {
+    // name from flash
+    memcpy_P (name, ST7735_STATS_NAMES[i], ST7735_STATS_NAME);
+    // print counter
+    print (name, st7735_stats.counters[i].calls, st7735_stats.counters[i].ticks);
+  }
+  // totals
+  memcpy_P (name, ST7735_STATS_NAMES[i++], ST7735_STATS_NAME);
+  print (name, st7735_stats.command_bytes, 0);
+  memcpy_P (name, ST7735_STATS_NAMES[i++], ST7735_STATS_NAME);
+  print (name, st7735_stats.data_bytes, 0);
+  memcpy_P (name, ST7735_STATS_NAMES[i], ST7735_STATS_NAME);
+  print (name, st7735_stats.cs_toggles, 0);
+}
+
+#endif
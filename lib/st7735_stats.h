@@ -0,0 +1,127 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - instrumentation
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_stats.h
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735_port.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Compiled only with ST7735_STATS, otherwise all hooks expand to nothing.
+ *              Counts calls and elapsed ticks of every driver entry point (inclusive, nested
+ *              calls are counted in both), command bytes, data bytes and chip selects.
+ *              On AVR ticks are Timer1 counts (ST7735_STATS_CLOCK prescaler, default
+ *              fclk/64 = 8 us at 8 MHz), on other targets microseconds. Timer1 is started
+ *              by ST7735_Stats_Reset.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include "st7735_port.h"
+
+#ifndef __ST7735_STATS_H__
+#define __ST7735_STATS_H__
+
+#if defined(ST7735_STATS)
+
+  // Timer1 prescaler bits of TCCR1B
+  // -----------------------------------
+  #ifndef ST7735_STATS_CLOCK
+    #define ST7735_STATS_CLOCK  ((1 << CS11) | (1 << CS10))
+  #endif
+
+  /** @enum Instrumented entry points */
+  enum st7735_stat {
+    ST7735_STAT_COMMAND,
+    ST7735_STAT_DATA,
+    ST7735_STAT_DATA8,
+    ST7735_STAT_DATA16,
+    ST7735_STAT_WINDOW,
+    ST7735_STAT_COLOR,
+    ST7735_STAT_FILL,
+    ST7735_STAT_PIXEL,
+    ST7735_STAT_CLEAR,
+    ST7735_STAT_CHAR,
+    ST7735_STAT_STRING,
+    ST7735_STAT_LINE,
+    ST7735_STAT_HLINE,
+    ST7735_STAT_VLINE,
+    ST7735_STAT_RECTANGLE,
+    ST7735_STAT_READ,
+    ST7735_STAT_PIXELS,
+    ST7735_STATS_COUNT
+  };
+
+  /** @struct Counter of entry point */
+  struct st7735_counter {
+    // number of calls
+    uint32_t calls;
+    // elapsed ticks
+    uint32_t ticks;
+  };
+
+  /** @struct Statistics */
+  struct st7735_stats {
+    // per entry point
+    struct st7735_counter counters[ST7735_STATS_COUNT];
+    // bytes sent with D/C low
+    uint32_t command_bytes;
+    // bytes sent with D/C high
+    uint32_t data_bytes;
+    // chip select activations
+    uint32_t cs_toggles;
+  };
+
+  /** @var Statistics of all displays */
+  extern struct st7735_stats st7735_stats;
+
+  // FUNCTION macros
+  // -----------------------------------
+  // start measuring entry point
+  #define ST7735_STATS_ENTER(id)          uint16_t st7735_tick = ST7735_Stats_Tick (); st7735_stats.counters[id].calls++
+  // stop measuring entry point
+  #define ST7735_STATS_LEAVE(id)          st7735_stats.counters[id].ticks += (uint16_t) (ST7735_Stats_Tick () - st7735_tick)
+  // add to counter
+  #define ST7735_STATS_ADD(field, n)      st7735_stats.field += (n)
+
+  /**
+   * @desc    Read tick counter
+   *
+   * @param   void
+   *
+   * @return  uint16_t
+   */
+  uint16_t ST7735_Stats_Tick (void);
+
+  /**
+   * @desc    Clear counters and start Timer1
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void ST7735_Stats_Reset (void);
+
+  /**
+   * @desc    Dump counters
+   *
+   * @param   void (*) (const char * name, uint32_t calls, uint32_t ticks)
+   *
+   * @return  void
+   */
+  void ST7735_Stats_Dump (void (*) (const char *, uint32_t, uint32_t));
+
+#else
+
+  #define ST7735_STATS_ENTER(id)
+  #define ST7735_STATS_LEAVE(id)
+  #define ST7735_STATS_ADD(field, n)
+
+#endif
+
+#endif
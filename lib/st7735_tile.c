@@ -0,0 +1,548 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - multithreaded tile rasteriser
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_tile.c
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735_tile.h, font.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Each job is one tile of one display. Worker clips every command of display
+ *              list to its tile and writes straight into frame, so tiles never share pixels
+ *              and need no locking. Shared lcd->clip is only read.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "st7735_port.h"
+#include "font.h"
+#include "st7735_tile.h"
+
+#if defined(ST7735_FRAMEBUFFER) && !defined(__AVR__)
+
+/**
+ * @desc    Append command
+ *
+ * @param   struct st7735_list *
+ * @param   struct st7735_cmd *
+ *
+ * @return  uint8_t
+ */
+static uint8_t ST7735_List_Append (struct st7735_list * list, const struct st7735_cmd * cmd)
+{
+  struct st7735_cmd * cmds;
+  uint16_t capacity;
+
+  // grow array
+  if (list->count == list->capacity) {
+    // double size
+    capacity = list->capacity ? (list->capacity << 1) : 64;
+    // reallocate
+    cmds = realloc (list->cmds, capacity * sizeof (struct st7735_cmd));
+    // out of memory
+    if (cmds == NULL) {
+      return ST7735_ERROR;
+    }
+    list->cmds = cmds;
+    list->capacity = capacity;
+  }
+  // store command
+  list->cmds[list->count++] = *cmd;
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Record pixel
+ *
+ * @param   struct st7735_list *
+ * @param   uint8_t x position
+ * @param   uint8_t y position
+ * @param   uint16_t color
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7735_List_Pixel (struct st7735_list * list, uint8_t x, uint8_t y, uint16_t color)
+{
+  struct st7735_cmd cmd = { .op = ST7735_OP_PIXEL, .x0 = x, .x1 = x, .y0 = y, .y1 = y, .color = color };
+
+  // store
+  return ST7735_List_Append (list, &cmd);
+}
+
+/**
+ * @desc    Record filled rectangle
+ *
+ * @param   struct st7735_list *
+ * @param   uint8_t x start position
+ * @param   uint8_t x end position
+ * @param   uint8_t y start position
+ * @param   uint8_t y end position
+ * @param   uint16_t color
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7735_List_Rectangle (struct st7735_list * list, uint8_t xs, uint8_t xe, uint8_t ys, uint8_t ye, uint16_t color)
+{
+  struct st7735_cmd cmd = { .op = ST7735_OP_RECT, .color = color };
+
+  // ordered coordinates
+  cmd.x0 = (xs < xe) ? xs : xe;
+  cmd.x1 = (xs < xe) ? xe : xs;
+  cmd.y0 = (ys < ye) ? ys : ye;
+  cmd.y1 = (ys < ye) ? ye : ys;
+  // store
+  return ST7735_List_Append (list, &cmd);
+}
+
+/**
+ * @desc    Record line
+ *
+ * @param   struct st7735_list *
+ * @param   uint8_t x start position
+ * @param   uint8_t x end position
+ * @param   uint8_t y start position
+ * @param   uint8_t y end position
+ * @param   uint16_t color
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7735_List_Line (struct st7735_list * list, uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2, uint16_t color)
+{
+  struct st7735_cmd cmd = { .op = ST7735_OP_LINE, .x0 = x1, .x1 = x2, .y0 = y1, .y1 = y2, .color = color };
+
+  // store
+  return ST7735_List_Append (list, &cmd);
+}
+
+/**
+ * @desc    Record string
+ *
+ * @param   struct st7735_list *
+ * @param   uint8_t x position
+ * @param   uint8_t y position
+ * @param   const char * string - must stay valid until render
+ * @param   uint16_t color
+ * @param   enum Size (X1, X2, X3)
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7735_List_String (struct st7735_list * list, uint8_t x, uint8_t y, const char * str, uint16_t color, enum Size size)
+{
+  struct st7735_cmd cmd = { .op = ST7735_OP_TEXT, .x0 = x, .y0 = y, .color = color, .size = size, .text = str };
+  uint16_t advance = (size == X3) ? (CHARS_COLS_LEN + CHARS_COLS_LEN + 1) : (CHARS_COLS_LEN + 1);
+  uint16_t width = strlen (str) * advance;
+  uint16_t height = (size == X1) ? CHARS_ROWS_LEN : (CHARS_ROWS_LEN << 1);
+
+  // bounding box limited to coordinates, screen is applied by render
+  cmd.x1 = ((x + width) > 0xFF) ? 0xFF : (x + width - (width ? 1 : 0));
+  cmd.y1 = ((y + height) > 0xFF) ? 0xFF : (y + height - 1);
+  // store
+  return ST7735_List_Append (list, &cmd);
+}
+
+/**
+ * @desc    Bounding box of command
+ *
+ * @param   struct st7735_cmd *
+ * @param   struct window *
+ *
+ * @return  void
+ */
+static void ST7735_Raster_Box (const struct st7735_cmd * cmd, struct window * box)
+{
+  box->x0 = (cmd->x0 < cmd->x1) ? cmd->x0 : cmd->x1;
+  box->x1 = (cmd->x0 < cmd->x1) ? cmd->x1 : cmd->x0;
+  box->y0 = (cmd->y0 < cmd->y1) ? cmd->y0 : cmd->y1;
+  box->y1 = (cmd->y0 < cmd->y1) ? cmd->y1 : cmd->y0;
+}
+
+/**
+ * @desc    Window of tile
+ *
+ * @param   struct st7735 *
+ * @param   uint8_t tile index
+ * @param   struct window *
+ *
+ * @return  void
+ */
+static void ST7735_Raster_Tile (const struct st7735 * lcd, uint8_t tile, struct window * win)
+{
+  win->x0 = (tile % ST7735_TILES_X) * ST7735_TILE_W;
+  win->y0 = (tile / ST7735_TILES_X) * ST7735_TILE_H;
+  win->x1 = ((win->x0 + ST7735_TILE_W) > lcd->width) ? lcd->width - 1 : (win->x0 + ST7735_TILE_W - 1);
+  win->y1 = ((win->y0 + ST7735_TILE_H) > lcd->height) ? lcd->height - 1 : (win->y0 + ST7735_TILE_H - 1);
+}
+
+/**
+ * @desc    Intersect windows
+ *
+ * @param   struct window * - updated
+ * @param   struct window *
+ *
+ * @return  uint8_t - ST7735_ERROR if empty
+ */
+static uint8_t ST7735_Raster_Intersect (struct window * win, const struct window * with)
+{
+  // disjoint
+  if ((win->x1 < with->x0) || (win->x0 > with->x1) ||
+      (win->y1 < with->y0) || (win->y0 > with->y1)) {
+    return ST7735_ERROR;
+  }
+  if (win->x0 < with->x0) { win->x0 = with->x0; }
+  if (win->x1 > with->x1) { win->x1 = with->x1; }
+  if (win->y0 < with->y0) { win->y0 = with->y0; }
+  if (win->y1 > with->y1) { win->y1 = with->y1; }
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Plot pixel inside clip
+ *
+ * @param   uint16_t * frame
+ * @param   uint8_t stride - width of frame
+ * @param   struct window * clip
+ * @param   int16_t x
+ * @param   int16_t y
+ * @param   uint16_t color
+ *
+ * @return  void
+ */
+static inline void ST7735_Raster_Plot (uint16_t * frame, uint8_t stride, const struct window * clip, int16_t x, int16_t y, uint16_t color)
+{
+  // inside clip
+  if ((x >= clip->x0) && (x <= clip->x1) && (y >= clip->y0) && (y <= clip->y1)) {
+    frame[y * stride + x] = color;
+  }
+}
+
+/**
+ * @desc    Rasterise line by Bresenham algoritm
+ *
+ * @param   uint16_t * frame
+ * @param   uint8_t stride - width of frame
+ * @param   struct window * clip
+ * @param   struct st7735_cmd *
+ *
+ * @return  void
+ */
+static void ST7735_Raster_Line (uint16_t * frame, uint8_t stride, const struct window * clip, const struct st7735_cmd * cmd)
+{
+  int16_t x = cmd->x0, y = cmd->y0;
+  int16_t dx = abs (cmd->x1 - cmd->x0);
+  int16_t dy = -abs (cmd->y1 - cmd->y0);
+  int16_t sx = (cmd->x0 < cmd->x1) ? 1 : -1;
+  int16_t sy = (cmd->y0 < cmd->y1) ? 1 : -1;
+  int16_t err = dx + dy;
+  int16_t e2;
+
+  // loop through line
+  for (;;) {
+    // draw pixel
+    ST7735_Raster_Plot (frame, stride, clip, x, y, cmd->color);
+    // end of line
+    if ((x == cmd->x1) && (y == cmd->y1)) {
+      break;
+    }
+    // step
+    e2 = err << 1;
+    if (e2 >= dy) { err += dy; x += sx; }
+    if (e2 <= dx) { err += dx; y += sy; }
+  }
+}
+
+/**
+ * @desc    Rasterise string
+ *
+ * @param   uint16_t * frame
+ * @param   uint8_t stride - width of frame
+ * @param   struct window * clip
+ * @param   struct st7735_cmd *
+ *
+ * @return  void
+ */
+static void ST7735_Raster_Text (uint16_t * frame, uint8_t stride, const struct window * clip, const struct st7735_cmd * cmd)
+{
+  const char * str = cmd->text;
+  uint8_t sx = (cmd->size == X3) ? 2 : 1;
+  uint8_t sy = (cmd->size == X1) ? 1 : 2;
+  int16_t x = cmd->x0;
+  uint8_t letter, col, row, i, j;
+
+  // loop through characters
+  for (; *str != '\0'; str++, x += CHARS_COLS_LEN * sx + 1) {
+    // right of clip
+    if (x > clip->x1) {
+      break;
+    }
+    // left of clip or out of font - blank, unsigned so 0x80 - 0xFF are not negative
+    if ((x + CHARS_COLS_LEN * sx <= clip->x0) || ((uint8_t) *str < 0x20) || ((uint8_t) *str > 0x7f)) {
+      continue;
+    }
+    // loop through columns
+    for (col = 0; col < CHARS_COLS_LEN; col++) {
+      // read from ROM memory
+      letter = pgm_read_byte (&FONTS[(uint8_t) *str - 32][col]);
+      // loop through rows
+      for (row = 0; row < CHARS_ROWS_LEN; row++) {
+        // bit set
+        if (letter & (1 << row)) {
+          for (i = 0; i < sx; i++) {
+            for (j = 0; j < sy; j++) {
+              ST7735_Raster_Plot (frame, stride, clip, x + col * sx + i, cmd->y0 + row * sy + j, cmd->color);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @desc    Rasterise one tile of display
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_list *
+ * @param   uint8_t tile index
+ *
+ * @return  void
+ */
+static void ST7735_Raster_Job (struct st7735 * lcd, const struct st7735_list * list, uint8_t tile)
+{
+  uint16_t * frame = lcd->fb->frame;
+  struct window clip;
+  struct window win;
+  uint16_t i;
+  uint16_t x, y;
+
+  // tile limited by clip rectangle of display
+  ST7735_Raster_Tile (lcd, tile, &clip);
+  if (ST7735_Raster_Intersect (&clip, &lcd->clip) == ST7735_ERROR) {
+    return;
+  }
+  // loop through commands in order
+  for (i = 0; i < list->count; i++) {
+    // bounding box in tile
+    ST7735_Raster_Box (&list->cmds[i], &win);
+    if (ST7735_Raster_Intersect (&win, &clip) == ST7735_ERROR) {
+      continue;
+    }
+    // rasterise
+    switch (list->cmds[i].op) {
+      case ST7735_OP_PIXEL:
+      case ST7735_OP_RECT:
+        for (y = win.y0; y <= win.y1; y++) {
+          for (x = win.x0; x <= win.x1; x++) {
+            frame[y * lcd->width + x] = list->cmds[i].color;
+          }
+        }
+        break;
+      case ST7735_OP_LINE:
+        ST7735_Raster_Line (frame, lcd->width, &clip, &list->cmds[i]);
+        break;
+      case ST7735_OP_TEXT:
+        ST7735_Raster_Text (frame, lcd->width, &clip, &list->cmds[i]);
+        break;
+    }
+  }
+}
+
+/**
+ * @desc    Worker thread
+ *
+ * @param   void * - struct st7735_raster *
+ *
+ * @return  void *
+ */
+static void * ST7735_Raster_Worker (void * arg)
+{
+  struct st7735_raster * pool = arg;
+  uint32_t generation = 0;
+  uint16_t job;
+
+  pthread_mutex_lock (&pool->lock);
+  // loop till stop
+  for (;;) {
+    // wait for new render
+    while (!pool->stop && (pool->generation == generation)) {
+      pthread_cond_wait (&pool->work, &pool->lock);
+    }
+    // stop
+    if (pool->stop) {
+      break;
+    }
+    generation = pool->generation;
+    // take jobs
+    while (pool->next < pool->count) {
+      job = pool->jobs[pool->next++];
+      pthread_mutex_unlock (&pool->lock);
+      // rasterise tile
+      ST7735_Raster_Job (pool->lcds[job >> 8], pool->lists[job >> 8], job & 0xFF);
+      pthread_mutex_lock (&pool->lock);
+      // last job done
+      if (--pool->remaining == 0) {
+        pthread_cond_signal (&pool->done);
+      }
+    }
+  }
+  pthread_mutex_unlock (&pool->lock);
+
+  return NULL;
+}
+
+/**
+ * @desc    Start worker pool
+ *
+ * @param   struct st7735_raster *
+ * @param   uint8_t number of workers
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7735_Raster_Init (struct st7735_raster * pool, uint8_t workers)
+{
+  // limit workers
+  if ((workers == 0) || (workers > ST7735_RASTER_THREADS)) {
+    return ST7735_ERROR;
+  }
+  memset (pool, 0, sizeof (struct st7735_raster));
+  pthread_mutex_init (&pool->lock, NULL);
+  pthread_cond_init (&pool->work, NULL);
+  pthread_cond_init (&pool->done, NULL);
+  // start workers
+  for (pool->workers = 0; pool->workers < workers; pool->workers++) {
+    if (pthread_create (&pool->threads[pool->workers], NULL, ST7735_Raster_Worker, pool) != 0) {
+      // stop started workers
+      ST7735_Raster_Free (pool);
+      return ST7735_ERROR;
+    }
+  }
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Stop worker pool
+ *
+ * @param   struct st7735_raster *
+ *
+ * @return  void
+ */
+void ST7735_Raster_Free (struct st7735_raster * pool)
+{
+  uint8_t i;
+
+  // wake up workers
+  pthread_mutex_lock (&pool->lock);
+  pool->stop = 1;
+  pthread_cond_broadcast (&pool->work);
+  pthread_mutex_unlock (&pool->lock);
+  // wait for workers
+  for (i = 0; i < pool->workers; i++) {
+    pthread_join (pool->threads[i], NULL);
+  }
+  pool->workers = 0;
+  pthread_cond_destroy (&pool->done);
+  pthread_cond_destroy (&pool->work);
+  pthread_mutex_destroy (&pool->lock);
+}
+
+/**
+ * @desc    Rasterise lists into framebuffers and flush dirty tiles
+ *
+ * @param   struct st7735_raster *
+ * @param   struct st7735 ** - displays with framebuffer attached
+ * @param   const struct st7735_list ** - list per display
+ * @param   uint8_t number of displays
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7735_Raster_Render (struct st7735_raster * pool, struct st7735 ** lcds, const struct st7735_list ** lists, uint8_t n)
+{
+  uint8_t dirty[ST7735_RASTER_DISPLAYS][ST7735_TILES];
+  struct window screen;
+  struct window box;
+  struct window win;
+  uint16_t i;
+  uint8_t d, tx, ty;
+
+  // check displays
+  if (n > ST7735_RASTER_DISPLAYS) {
+    return ST7735_ERROR;
+  }
+  for (d = 0; d < n; d++) {
+    if (lcds[d]->fb == NULL) {
+      return ST7735_ERROR;
+    }
+  }
+
+  // dirty tiles from bounding boxes
+  memset (dirty, 0, sizeof (dirty));
+  pthread_mutex_lock (&pool->lock);
+  pool->count = 0;
+  for (d = 0; d < n; d++) {
+    // screen of current rotation
+    screen.x0 = 0;
+    screen.x1 = lcds[d]->width - 1;
+    screen.y0 = 0;
+    screen.y1 = lcds[d]->height - 1;
+    for (i = 0; i < lists[d]->count; i++) {
+      ST7735_Raster_Box (&lists[d]->cmds[i], &box);
+      // off screen
+      if (ST7735_Raster_Intersect (&box, &screen) == ST7735_ERROR) {
+        continue;
+      }
+      for (ty = box.y0 / ST7735_TILE_H; ty <= box.y1 / ST7735_TILE_H; ty++) {
+        for (tx = box.x0 / ST7735_TILE_W; tx <= box.x1 / ST7735_TILE_W; tx++) {
+          dirty[d][ty * ST7735_TILES_X + tx] = 1;
+        }
+      }
+    }
+    // one job per dirty tile
+    for (i = 0; i < ST7735_TILES; i++) {
+      if (dirty[d][i]) {
+        pool->jobs[pool->count++] = (d << 8) | i;
+      }
+    }
+  }
+  // hand jobs to workers
+  pool->lcds = lcds;
+  pool->lists = lists;
+  pool->next = 0;
+  pool->remaining = pool->count;
+  if (pool->count) {
+    pool->generation++;
+    pthread_cond_broadcast (&pool->work);
+    // wait till all tiles are rasterised
+    while (pool->remaining) {
+      pthread_cond_wait (&pool->done, &pool->lock);
+    }
+  }
+  pthread_mutex_unlock (&pool->lock);
+
+  // flush dirty tiles in order
+  for (d = 0; d < n; d++) {
+    // panel content unknown - whole screen
+    if (!lcds[d]->fb->valid) {
+      ST7735_FB_Flush (lcds[d]);
+      continue;
+    }
+    for (i = 0; i < ST7735_TILES; i++) {
+      if (dirty[d][i]) {
+        ST7735_Raster_Tile (lcds[d], i, &win);
+        ST7735_FB_FlushWindow (lcds[d], &win);
+      }
+    }
+  }
+  // success
+  return ST7735_SUCCESS;
+}
+
+#endif
@@ -0,0 +1,193 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - multithreaded tile rasteriser
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_tile.h
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735_fb.h, pthread
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Host framebuffer build only (ST7735_FRAMEBUFFER, link with -pthread).
+ *              Commands are recorded into display list per display. ST7735_Raster_Render
+ *              splits frames into tiles, rasterises tiles touched by commands on worker
+ *              pool and then flushes dirty tiles to bus in order, display by display.
+ *              Text pointers of list must stay valid until render returns.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include "st7735_fb.h"
+
+#ifndef __ST7735_TILE_H__
+#define __ST7735_TILE_H__
+
+#if defined(ST7735_FRAMEBUFFER) && !defined(__AVR__)
+
+  #include <pthread.h>
+
+  // Tiles
+  // -----------------------------------
+  #define ST7735_TILE_W         32
+  #define ST7735_TILE_H         32
+  // grid covers longer side in both directions, so any rotation fits
+  #define ST7735_TILES_X        ((MAX_X + ST7735_TILE_W - 1) / ST7735_TILE_W)
+  #define ST7735_TILES_Y        ((MAX_X + ST7735_TILE_H - 1) / ST7735_TILE_H)
+  #define ST7735_TILES          (ST7735_TILES_X * ST7735_TILES_Y)
+
+  // Pool
+  // -----------------------------------
+  #define ST7735_RASTER_THREADS   16            // max workers
+  #define ST7735_RASTER_DISPLAYS  16            // max displays per render
+
+  /** @enum Display list operations */
+  enum st7735_op {
+    ST7735_OP_PIXEL,
+    ST7735_OP_RECT,
+    ST7735_OP_LINE,
+    ST7735_OP_TEXT
+  };
+
+  /** @struct Display list command */
+  struct st7735_cmd {
+    // operation
+    enum st7735_op op;
+    // x start / end position
+    uint8_t x0;
+    uint8_t x1;
+    // y start / end position
+    uint8_t y0;
+    uint8_t y1;
+    // color
+    uint16_t color;
+    // text size
+    enum Size size;
+    // text
+    const char * text;
+  };
+
+  /** @struct Display list */
+  struct st7735_list {
+    // commands
+    struct st7735_cmd * cmds;
+    // number of commands
+    uint16_t count;
+    // size of cmds array
+    uint16_t capacity;
+  };
+
+  /** @struct Worker pool */
+  struct st7735_raster {
+    // workers
+    pthread_t threads[ST7735_RASTER_THREADS];
+    uint8_t workers;
+    // job state protected by lock
+    pthread_mutex_t lock;
+    pthread_cond_t work;
+    pthread_cond_t done;
+    // generation of render - workers wake up when changed
+    uint32_t generation;
+    // stop workers
+    uint8_t stop;
+    // displays and lists of current render
+    struct st7735 ** lcds;
+    const struct st7735_list ** lists;
+    // jobs - display index << 8 | tile index
+    uint16_t jobs[ST7735_RASTER_DISPLAYS * ST7735_TILES];
+    uint16_t count;
+    uint16_t next;
+    uint16_t remaining;
+  };
+
+  /**
+   * @desc    Record pixel
+   *
+   * @param   struct st7735_list *
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   uint16_t
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_List_Pixel (struct st7735_list *, uint8_t, uint8_t, uint16_t);
+
+  /**
+   * @desc    Record filled rectangle
+   *
+   * @param   struct st7735_list *
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   uint16_t
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_List_Rectangle (struct st7735_list *, uint8_t, uint8_t, uint8_t, uint8_t, uint16_t);
+
+  /**
+   * @desc    Record line
+   *
+   * @param   struct st7735_list *
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   uint16_t
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_List_Line (struct st7735_list *, uint8_t, uint8_t, uint8_t, uint8_t, uint16_t);
+
+  /**
+   * @desc    Record string
+   *
+   * @param   struct st7735_list *
+   * @param   uint8_t
+   * @param   uint8_t
+   * @param   const char *
+   * @param   uint16_t
+   * @param   enum Size
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_List_String (struct st7735_list *, uint8_t, uint8_t, const char *, uint16_t, enum Size);
+
+  /**
+   * @desc    Start worker pool
+   *
+   * @param   struct st7735_raster *
+   * @param   uint8_t
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_Raster_Init (struct st7735_raster *, uint8_t);
+
+  /**
+   * @desc    Stop worker pool
+   *
+   * @param   struct st7735_raster *
+   *
+   * @return  void
+   */
+  void ST7735_Raster_Free (struct st7735_raster *);
+
+  /**
+   * @desc    Rasterise lists into framebuffers and flush dirty tiles
+   *
+   * @param   struct st7735_raster *
+   * @param   struct st7735 **
+   * @param   const struct st7735_list **
+   * @param   uint8_t
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_Raster_Render (struct st7735_raster *, struct st7735 **, const struct st7735_list **, uint8_t);
+
+#endif
+
+#endif
@@ -0,0 +1,347 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - incremental widgets
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_widget.c
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735_widget.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Bar moving from n to m pixels sends |m - n| rows or columns, so filling bar
+ *              of length L step by step costs L, not L^2 / 2 as repainting whole bar.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include "st7735_port.h"
+#include "st7735_widget.h"
+
+/** @array Sine 0 - 90 degrees, 255 = 1.0 */
+static const uint8_t SINE[91] PROGMEM = {
+    0,   4,   9,  13,  18,  22,  27,  31,  35,  40,  44,  49,  53,
+   57,  62,  66,  70,  75,  79,  83,  87,  91,  96, 100, 104, 108,
+  112, 116, 120, 124, 127, 131, 135, 139, 143, 146, 150, 153, 157,
+  160, 164, 167, 171, 174, 177, 180, 183, 186, 190, 192, 195, 198,
+  201, 204, 206, 209, 211, 214, 216, 219, 221, 223, 225, 227, 229,
+  231, 233, 235, 236, 238, 240, 241, 243, 244, 245, 246, 247, 248,
+  249, 250, 251, 252, 253, 253, 254, 254, 254, 255, 255, 255, 255
+};
+
+/**
+ * @desc    Scale value to pixels
+ *
+ * @param   uint16_t value
+ * @param   uint16_t max
+ * @param   uint8_t length - pixels of max
+ *
+ * @return  uint8_t
+ */
+static uint8_t ST7735_Widget_Scale (uint16_t value, uint16_t max, uint8_t length)
+{
+  // limit
+  if (value >= max) {
+    return length;
+  }
+  // pixels
+  return (uint32_t) value * length / max;
+}
+
+/**
+ * @desc    Fill or clear span between old and new length of bar
+ *
+ * @param   struct st7735 *
+ * @param   struct window * area
+ * @param   uint8_t vertical
+ * @param   uint8_t * filled - updated
+ * @param   uint8_t pixels - new length
+ * @param   uint16_t color - filled
+ * @param   uint16_t color - empty
+ *
+ * @return  void
+ */
+static void ST7735_Widget_Span (struct st7735 * lcd, const struct window * area, uint8_t vertical, uint8_t * filled, uint8_t pixels, uint16_t fg, uint16_t bg)
+{
+  uint8_t low = (pixels > *filled) ? *filled : pixels;
+  uint8_t high = (pixels > *filled) ? pixels : *filled;
+  uint16_t color = (pixels > *filled) ? fg : bg;
+
+  // unchanged
+  if (low == high) {
+    return;
+  }
+  // rows from bottom up
+  if (vertical) {
+    ST7735_FillWindow (lcd, area->x0, area->x1, area->y1 - high + 1, area->y1 - low, color);
+  // columns from left
+  } else {
+    ST7735_FillWindow (lcd, area->x0 + low, area->x0 + high - 1, area->y0, area->y1, color);
+  }
+  // on display now
+  *filled = pixels;
+}
+
+/**
+ * @desc    Draw empty progress bar
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_bar *
+ *
+ * @return  void
+ */
+void ST7735_Bar_Init (struct st7735 * lcd, struct st7735_bar * bar)
+{
+  // whole bar empty
+  ST7735_FillWindow (lcd, bar->area.x0, bar->area.x1, bar->area.y0, bar->area.y1, bar->bg);
+  bar->filled = 0;
+}
+
+/**
+ * @desc    Set value of progress bar
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_bar *
+ * @param   uint16_t value - 0 - max
+ *
+ * @return  void
+ */
+void ST7735_Bar_Set (struct st7735 * lcd, struct st7735_bar * bar, uint16_t value)
+{
+  // pixels of bar
+  uint8_t length = bar->vertical ? (bar->area.y1 - bar->area.y0 + 1) : (bar->area.x1 - bar->area.x0 + 1);
+
+  // changed span only
+  ST7735_Widget_Span (lcd, &bar->area, bar->vertical, &bar->filled, ST7735_Widget_Scale (value, bar->max, length), bar->fg, bar->bg);
+}
+
+/**
+ * @desc    Area of one bar
+ *
+ * @param   struct st7735_bargraph *
+ * @param   uint8_t index
+ * @param   struct window *
+ *
+ * @return  void
+ */
+static void ST7735_BarGraph_Area (const struct st7735_bargraph * graph, uint8_t index, struct window * win)
+{
+  // width of bar
+  uint8_t width = ((graph->area.x1 - graph->area.x0 + 1) - (graph->bars - 1) * graph->gap) / graph->bars;
+
+  win->x0 = graph->area.x0 + index * (width + graph->gap);
+  win->x1 = win->x0 + width - 1;
+  win->y0 = graph->area.y0;
+  win->y1 = graph->area.y1;
+}
+
+/**
+ * @desc    Draw empty bar graph
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_bargraph *
+ *
+ * @return  void
+ */
+void ST7735_BarGraph_Init (struct st7735 * lcd, struct st7735_bargraph * graph)
+{
+  uint8_t i;
+
+  // whole graph empty
+  ST7735_FillWindow (lcd, graph->area.x0, graph->area.x1, graph->area.y0, graph->area.y1, graph->bg);
+  // loop through bars
+  for (i = 0; i < graph->bars; i++) {
+    graph->filled[i] = 0;
+  }
+}
+
+/**
+ * @desc    Set value of one bar
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_bargraph *
+ * @param   uint8_t index of bar
+ * @param   uint16_t value - 0 - max
+ *
+ * @return  void
+ */
+void ST7735_BarGraph_Set (struct st7735 * lcd, struct st7735_bargraph * graph, uint8_t index, uint16_t value)
+{
+  struct window win;
+
+  // no such bar
+  if (index >= graph->bars) {
+    return;
+  }
+  ST7735_BarGraph_Area (graph, index, &win);
+  // changed span only
+  ST7735_Widget_Span (lcd, &win, 1, &graph->filled[index], ST7735_Widget_Scale (value, graph->max, win.y1 - win.y0 + 1), graph->fg, graph->bg);
+}
+
+/**
+ * @desc    Draw empty strip chart
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_chart *
+ *
+ * @return  uint8_t - ST7735_ERROR if max <= min
+ */
+uint8_t ST7735_Chart_Init (struct st7735 * lcd, struct st7735_chart * chart)
+{
+  uint8_t i;
+
+  // no range to scale
+  if (chart->max <= chart->min) {
+    return ST7735_ERROR;
+  }
+  // whole chart empty
+  ST7735_FillWindow (lcd, chart->area.x0, chart->area.x1, chart->area.y0, chart->area.y1, chart->bg);
+  // loop through columns
+  for (i = 0; i <= chart->area.x1 - chart->area.x0; i++) {
+    chart->samples[i] = ST7735_CHART_EMPTY;
+  }
+  chart->next = 0;
+  chart->erased = ST7735_CHART_EMPTY;
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Vertical span of column between two rows
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_chart *
+ * @param   uint8_t column
+ * @param   uint8_t row - previous column, ST7735_CHART_EMPTY = none
+ * @param   uint8_t row
+ * @param   uint16_t color
+ *
+ * @return  void
+ */
+static void ST7735_Chart_Span (struct st7735 * lcd, const struct st7735_chart * chart, uint8_t column, uint8_t from, uint8_t to, uint16_t color)
+{
+  // nothing plotted
+  if (to == ST7735_CHART_EMPTY) {
+    return;
+  }
+  // single point
+  if (from == ST7735_CHART_EMPTY) {
+    from = to;
+  }
+  // one burst
+  ST7735_FillWindow (lcd, chart->area.x0 + column, chart->area.x0 + column, (from < to) ? from : to, (from < to) ? to : from, color);
+}
+
+/**
+ * @desc    Add sample to strip chart
+ *          oldest column is erased and new one drawn as vertical spans joined
+ *          to previous column, cost does not depend on chart width
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_chart *
+ * @param   int16_t value - min - max
+ *
+ * @return  void
+ */
+void ST7735_Chart_Add (struct st7735 * lcd, struct st7735_chart * chart, int16_t value)
+{
+  uint8_t height = chart->area.y1 - chart->area.y0;
+  uint8_t column = chart->next;
+  uint8_t oldest = chart->samples[column];
+  uint8_t previous = column ? chart->samples[column - 1] : ST7735_CHART_EMPTY;
+  uint8_t row;
+
+  // rejected by init
+  if (chart->max <= chart->min) {
+    return;
+  }
+  // limit
+  if (value < chart->min) {
+    value = chart->min;
+  } else if (value > chart->max) {
+    value = chart->max;
+  }
+  // row of value, min at bottom
+  row = chart->area.y1 - (uint8_t) (((int32_t) value - chart->min) * height / ((int32_t) chart->max - chart->min));
+  // erase oldest - joined to column before as it was then
+  ST7735_Chart_Span (lcd, chart, column, column ? chart->erased : ST7735_CHART_EMPTY, oldest, chart->bg);
+  // draw newest - joined to column before
+  ST7735_Chart_Span (lcd, chart, column, previous, row, chart->fg);
+  // store
+  chart->erased = oldest;
+  chart->samples[column] = row;
+  // next column, wrap
+  chart->next = (column == chart->area.x1 - chart->area.x0) ? 0 : column + 1;
+}
+
+/**
+ * @desc    End of needle for value
+ *
+ * @param   struct st7735_gauge *
+ * @param   uint16_t value
+ * @param   uint8_t * x
+ * @param   uint8_t * y
+ *
+ * @return  void
+ */
+static void ST7735_Gauge_Tip (const struct st7735_gauge * gauge, uint16_t value, uint8_t * x, uint8_t * y)
+{
+  // degrees, 0 = left, 180 = right
+  uint8_t angle = ST7735_Widget_Scale (value, gauge->max, 180);
+  // sine and cosine of angle from left
+  uint8_t sine = pgm_read_byte (&SINE[(angle <= 90) ? angle : 180 - angle]);
+  uint8_t cosine = pgm_read_byte (&SINE[(angle <= 90) ? 90 - angle : angle - 90]);
+  // offsets rounded
+  uint8_t dx = ((uint16_t) gauge->radius * cosine + 127) / 255;
+  uint8_t dy = ((uint16_t) gauge->radius * sine + 127) / 255;
+
+  // left or right half
+  *x = (angle <= 90) ? gauge->x - dx : gauge->x + dx;
+  *y = gauge->y - dy;
+}
+
+/**
+ * @desc    Draw gauge needle at zero
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_gauge *
+ *
+ * @return  void
+ */
+void ST7735_Gauge_Init (struct st7735 * lcd, struct st7735_gauge * gauge)
+{
+  // needle at zero
+  ST7735_Gauge_Tip (gauge, 0, &gauge->tip_x, &gauge->tip_y);
+  ST7735_DrawLine (lcd, gauge->x, gauge->tip_x, gauge->y, gauge->tip_y, gauge->fg);
+}
+
+/**
+ * @desc    Set value of gauge
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_gauge *
+ * @param   uint16_t value - 0 - max
+ *
+ * @return  void
+ */
+void ST7735_Gauge_Set (struct st7735 * lcd, struct st7735_gauge * gauge, uint16_t value)
+{
+  uint8_t x;
+  uint8_t y;
+
+  ST7735_Gauge_Tip (gauge, value, &x, &y);
+  // needle not moved
+  if ((x == gauge->tip_x) && (y == gauge->tip_y)) {
+    return;
+  }
+  // erase old needle
+  ST7735_DrawLine (lcd, gauge->x, gauge->tip_x, gauge->y, gauge->tip_y, gauge->bg);
+  // draw new needle
+  ST7735_DrawLine (lcd, gauge->x, x, gauge->y, y, gauge->fg);
+  // on display now
+  gauge->tip_x = x;
+  gauge->tip_y = y;
+}
@@ -0,0 +1,184 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - incremental widgets
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_widget.h
+ * @version     2.0
+ * @tested      Linux host build, not run on hardware
+ *
+ * @depend      st7735.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Widgets remember what is drawn and send only the change: bars fill or clear
+ *              the span between old and new length, strip chart erases oldest column and
+ *              draws new one, gauge erases old needle and draws new one. Face under needle
+ *              is expected to be background color.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include "st7735.h"
+
+#ifndef __ST7735_WIDGET_H__
+#define __ST7735_WIDGET_H__
+
+  // Strip chart
+  // -----------------------------------
+  #define ST7735_CHART_EMPTY    0xFF              // column without sample
+
+  /** @struct Progress bar */
+  struct st7735_bar {
+    // area of bar
+    struct window area;
+    // grows from bottom up instead of left to right
+    uint8_t vertical;
+    // value of full bar
+    uint16_t max;
+    // colors of filled and empty part
+    uint16_t fg;
+    uint16_t bg;
+    // filled pixels on display
+    uint8_t filled;
+  };
+
+  /** @struct Bar graph - vertical bars side by side */
+  struct st7735_bargraph {
+    // area of all bars
+    struct window area;
+    // number of bars
+    uint8_t bars;
+    // pixels between bars
+    uint8_t gap;
+    // value of full bar
+    uint16_t max;
+    // colors of filled and empty part
+    uint16_t fg;
+    uint16_t bg;
+    // filled pixels on display per bar, array of bars items
+    uint8_t * filled;
+  };
+
+  /** @struct Strip chart - sweeps from left to right, column per sample */
+  struct st7735_chart {
+    // plot area
+    struct window area;
+    // values at bottom and top, max > min
+    int16_t min;
+    int16_t max;
+    // colors of trace and background
+    uint16_t fg;
+    uint16_t bg;
+    // ring buffer of plotted rows, one per column of area
+    uint8_t * samples;
+    // column of next sample
+    uint8_t next;
+    // row previously plotted in column before next
+    uint8_t erased;
+  };
+
+  /** @struct Needle gauge - half circle, value grows from left to right */
+  struct st7735_gauge {
+    // center
+    uint8_t x;
+    uint8_t y;
+    // needle length
+    uint8_t radius;
+    // value of right end
+    uint16_t max;
+    // colors of needle and face
+    uint16_t fg;
+    uint16_t bg;
+    // needle end on display
+    uint8_t tip_x;
+    uint8_t tip_y;
+  };
+
+  /**
+   * @desc    Draw empty progress bar
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_bar *
+   *
+   * @return  void
+   */
+  void ST7735_Bar_Init (struct st7735 *, struct st7735_bar *);
+
+  /**
+   * @desc    Set value of progress bar
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_bar *
+   * @param   uint16_t
+   *
+   * @return  void
+   */
+  void ST7735_Bar_Set (struct st7735 *, struct st7735_bar *, uint16_t);
+
+  /**
+   * @desc    Draw empty bar graph
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_bargraph *
+   *
+   * @return  void
+   */
+  void ST7735_BarGraph_Init (struct st7735 *, struct st7735_bargraph *);
+
+  /**
+   * @desc    Set value of one bar
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_bargraph *
+   * @param   uint8_t
+   * @param   uint16_t
+   *
+   * @return  void
+   */
+  void ST7735_BarGraph_Set (struct st7735 *, struct st7735_bargraph *, uint8_t, uint16_t);
+
+  /**
+   * @desc    Draw empty strip chart
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_chart *
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_Chart_Init (struct st7735 *, struct st7735_chart *);
+
+  /**
+   * @desc    Add sample to strip chart
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_chart *
+   * @param   int16_t
+   *
+   * @return  void
+   */
+  void ST7735_Chart_Add (struct st7735 *, struct st7735_chart *, int16_t);
+
+  /**
+   * @desc    Draw gauge needle at zero
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_gauge *
+   *
+   * @return  void
+   */
+  void ST7735_Gauge_Init (struct st7735 *, struct st7735_gauge *);
+
+  /**
+   * @desc    Set value of gauge
+   *
+   * @param   struct st7735 *
+   * @param   struct st7735_gauge *
+   * @param   uint16_t
+   *
+   * @return  void
+   */
+  void ST7735_Gauge_Set (struct st7735 *, struct st7735_gauge *, uint16_t);
+
+#endif
@@ -18,6 +18,7 @@
  *              Version 2.0 -> applicable for more than 1 display
  */
 #include "lib/st7735.h"
+#include "lib/st7735_widget.h"
 
 /**
  * @desc    Main function
@@ -59,31 +60,37 @@ int main (void)
   // LCD struct
   struct st7735 lcd2 = { .cs = &cs2, .bl = &bl2, .dc = &dc2, .rs = &rs2 };
 
+  // LCD 1 & LCD 2 - reset and init delays overlap
+  // ----------------------------------------------------------
+  struct st7735 * lcds[] = { &lcd1, &lcd2 };
+  // init both displays together
+  ST7735_InitGroup (lcds, 2);
+
   // LCD 1
   // ----------------------------------------------------------
-  // init lcd 1
-  ST7735_Init (&lcd1);
   // clear screen
   ST7735_ClearScreen (&lcd1, BLACK);
   // set position X, Y
-  ST7735_SetPosition (start + 5, 10);  
+  ST7735_SetPosition (&lcd1, start + 5, 10);  
   // draw string
   ST7735_DrawString (&lcd1, "Loading DATA ...", WHITE, X2);
 
+  // loading bar - each step draws only new column
+  struct st7735_bar loading = { .area = { .x0 = start, .x1 = end - 1, .y0 = 30, .y1 = 40 }, .max = end - start, .fg = RED, .bg = BLACK };
+  // draw empty bar
+  ST7735_Bar_Init (&lcd1, &loading);
   // draw Loading
-  for (uint8_t i = start; i < end; i++) {
-    // draw rectangle
-    ST7735_DrawRectangle (&lcd1, start, i, 30, 40, RED);
+  for (uint8_t i = 0; i <= end - start; i++) {
+    // grow bar
+    ST7735_Bar_Set (&lcd1, &loading, i);
   }
 
   // LCD 2
   // ----------------------------------------------------------
-  // init lcd 2
-  ST7735_Init (&lcd2);
   // clear screen
   ST7735_ClearScreen (&lcd2, BLACK);
   // set position X, Y
-  ST7735_SetPosition (17, 10);  
+  ST7735_SetPosition (&lcd2, 17, 10);  
   // draw string
   ST7735_DrawString (&lcd2, "ST7735 LCD 2", WHITE, X3);
   // draw fast horizontal line
@@ -0,0 +1,403 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - host test of image streaming
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       19.10.2026
+ * @file        st7735_image.c
+ * @version     2.0
+ * @tested      Linux (make test)
+ *
+ * @depend      lib/st7735_image.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       BMP and raw565 fixtures are written into temporary files and drawn through
+ *              ST7735_Image_FileRead on capture bus, which models GRAM of controller
+ *              (CASET, RASET, RAMWR; MADCTL exchange and mirroring around whole 132 x 162
+ *              GRAM as ST7735S does), and into framebuffer. Every pixel of screen is
+ *              compared with expected picture. Run by 'make test'.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "lib/st7735.h"
+#include "lib/st7735_fb.h"
+#include "lib/st7735_image.h"
+
+// Test settings
+// -----------------------------------
+#define TEST_BLOCK              64                // storage block, small to cross blocks often
+#define TEST_BACKGROUND         0x1234            // screen color before image
+#define TEST_OFFSET             100               // image position in storage
+#define TEST_GRAM_W             132               // columns of controller GRAM
+#define TEST_GRAM_H             162               // rows of controller GRAM
+
+/** @enum Fixture formats */
+enum test_format {
+  TEST_BGR888 = 0,
+  TEST_BMP565,
+  TEST_BMP555,
+  TEST_RAW565
+};
+
+/** @struct Capture bus - GRAM of panel */
+static struct {
+  uint16_t gram[TEST_GRAM_W * TEST_GRAM_H];
+  uint8_t mode;
+  uint8_t command;
+  uint8_t args[4];
+  uint8_t count;
+  uint8_t madctl;
+  uint16_t xs, xe, ys, ye;
+  uint32_t pixel;
+  uint8_t high;
+  uint8_t pending;
+} capture;
+
+/** @var Blocks read by storage */
+static uint32_t blocks;
+
+/** @var Failed checks */
+static int failed;
+
+static void Capture_Init (struct st7735 * lcd) { (void) lcd; }
+static void Capture_Select (struct st7735 * lcd, uint8_t state) { (void) lcd; (void) state; }
+static void Capture_Reset (struct st7735 * lcd, uint8_t level) { (void) lcd; (void) level; }
+static void Capture_Mode (struct st7735 * lcd, uint8_t mode) { (void) lcd; capture.mode = mode; }
+
+/**
+ * @desc    GRAM cell of address as controller maps it
+ *
+ * @param   uint8_t madctl
+ * @param   uint16_t column - CASET address
+ * @param   uint16_t row - RASET address
+ *
+ * @return  int32_t - index, -1 = out of GRAM
+ */
+static int32_t Capture_Cell (uint8_t madctl, uint16_t column, uint16_t row)
+{
+  uint16_t x = column;
+  uint16_t y = row;
+
+  // row / column exchange
+  if (madctl & MADCTL_MV) {
+    x = row;
+    y = column;
+  }
+  if ((x >= TEST_GRAM_W) || (y >= TEST_GRAM_H)) {
+    return -1;
+  }
+  // mirrored around whole GRAM, not around visible part
+  if (madctl & MADCTL_MX) {
+    x = TEST_GRAM_W - 1 - x;
+  }
+  if (madctl & MADCTL_MY) {
+    y = TEST_GRAM_H - 1 - y;
+  }
+  return (int32_t) y * TEST_GRAM_W + x;
+}
+
+/**
+ * @desc    Interpret bytes as panel does
+ *
+ * @param   struct st7735 *
+ * @param   const uint8_t * buffer
+ * @param   uint16_t length
+ *
+ * @return  void
+ */
+static void Capture_Write (struct st7735 * lcd, const uint8_t * buffer, uint16_t length)
+{
+  uint16_t width;
+  int32_t cell;
+
+  (void) lcd;
+  while (length--) {
+    // command starts new sequence
+    if (capture.mode == ST7735_COMMAND) {
+      capture.command = *buffer++;
+      capture.count = 0;
+      capture.pixel = 0;
+      capture.pending = 0;
+      continue;
+    }
+    // parameters
+    if ((capture.command == CASET) || (capture.command == RASET)) {
+      capture.args[capture.count++ & 3] = *buffer++;
+      if (capture.count == 4) {
+        if (capture.command == CASET) {
+          capture.xs = (capture.args[0] << 8) | capture.args[1];
+          capture.xe = (capture.args[2] << 8) | capture.args[3];
+        } else {
+          capture.ys = (capture.args[0] << 8) | capture.args[1];
+          capture.ye = (capture.args[2] << 8) | capture.args[3];
+        }
+      }
+    } else if (capture.command == MADCTL) {
+      capture.madctl = *buffer++;
+    } else if (capture.command == RAMWR) {
+      // high byte first
+      if (!capture.pending) {
+        capture.high = *buffer++;
+        capture.pending = 1;
+        continue;
+      }
+      capture.pending = 0;
+      width = capture.xe - capture.xs + 1;
+      cell = Capture_Cell (capture.madctl, capture.xs + capture.pixel % width, capture.ys + capture.pixel / width);
+      capture.pixel++;
+      if (cell >= 0) {
+        capture.gram[cell] = (capture.high << 8) | *buffer;
+      }
+      buffer++;
+    } else {
+      buffer++;
+    }
+  }
+}
+
+/** @const Capture bus */
+static const struct st7735_bus CAPTURE = {
+  .init   = Capture_Init,
+  .select = Capture_Select,
+  .mode   = Capture_Mode,
+  .reset  = Capture_Reset,
+  .write  = Capture_Write
+};
+
+/**
+ * @desc    Read block of file, counted
+ *
+ * @param   struct st7735_storage *
+ * @param   uint32_t block
+ *
+ * @return  uint8_t
+ */
+static uint8_t Test_Read (struct st7735_storage * storage, uint32_t block)
+{
+  blocks++;
+  return ST7735_Image_FileRead (storage, block);
+}
+
+/**
+ * @desc    Color of picture pixel
+ *
+ * @param   uint16_t x
+ * @param   uint16_t y
+ *
+ * @return  uint16_t - 565
+ */
+static uint16_t Test_Color (uint16_t x, uint16_t y)
+{
+  return (uint16_t) (((x * 7) & 0x1F) << 11) | (((y * 5 + x) & 0x3F) << 5) | ((x ^ y) & 0x1F);
+}
+
+/**
+ * @desc    Expected 565 of picture pixel after format conversion
+ *
+ * @param   uint16_t color
+ * @param   enum test_format
+ *
+ * @return  uint16_t
+ */
+static uint16_t Test_Expected (uint16_t color, enum test_format format)
+{
+  uint16_t green = (color >> 6) & 0x1F;
+
+  // green 6 bits stored as 5 bits, top bit repeated
+  if (format == TEST_BMP555) {
+    return (color & 0xF81F) | (green << 6) | ((green >> 4) << 5);
+  }
+  return color;
+}
+
+/**
+ * @desc    Little endian value
+ *
+ * @param   uint8_t * bytes
+ * @param   uint32_t value
+ * @param   uint8_t count
+ *
+ * @return  void
+ */
+static void Test_Put (uint8_t * bytes, uint32_t value, uint8_t count)
+{
+  while (count--) {
+    *bytes++ = value & 0xFF;
+    value >>= 8;
+  }
+}
+
+/**
+ * @desc    Write fixture at TEST_OFFSET of temporary file
+ *
+ * @param   enum test_format
+ * @param   uint16_t width
+ * @param   uint16_t height
+ * @param   uint8_t top-down rows
+ *
+ * @return  FILE *
+ */
+static FILE * Test_Fixture (enum test_format format, uint16_t width, uint16_t height, uint8_t topdown)
+{
+  FILE * file = tmpfile ();
+  uint8_t bytes = (format == TEST_BGR888) ? 3 : 2;
+  uint8_t padding = (format == TEST_RAW565) ? 0 : (4 - ((width * bytes) & 3)) & 3;
+  uint8_t header[66] = { 'B', 'M' };
+  uint8_t pixel[3];
+  uint16_t color;
+  uint16_t x, y, row;
+
+  // garbage before image
+  for (x = 0; x < TEST_OFFSET; x++) {
+    fputc (0xA5, file);
+  }
+  if (format != TEST_RAW565) {
+    Test_Put (&header[10], (format == TEST_BMP565) ? 66 : 54, 4);
+    Test_Put (&header[14], 40, 4);
+    Test_Put (&header[18], width, 4);
+    Test_Put (&header[22], topdown ? (uint32_t) -(int32_t) height : height, 4);
+    Test_Put (&header[26], 1, 2);
+    Test_Put (&header[28], bytes << 3, 2);
+    // BI_BITFIELDS with 565 masks
+    if (format == TEST_BMP565) {
+      Test_Put (&header[30], 3, 4);
+      Test_Put (&header[54], 0xF800, 4);
+      Test_Put (&header[58], 0x07E0, 4);
+      Test_Put (&header[62], 0x001F, 4);
+    }
+    fwrite (header, 1, (format == TEST_BMP565) ? 66 : 54, file);
+  }
+  // loop through rows in storage order
+  for (row = 0; row < height; row++) {
+    y = ((format == TEST_RAW565) || topdown) ? row : height - 1 - row;
+    for (x = 0; x < width; x++) {
+      color = Test_Color (x, y);
+      if (format == TEST_BGR888) {
+        pixel[0] = (color & 0x1F) << 3;
+        pixel[1] = ((color >> 5) & 0x3F) << 2;
+        pixel[2] = (color >> 11) << 3;
+      } else if (format == TEST_BMP565) {
+        Test_Put (pixel, color, 2);
+      } else if (format == TEST_BMP555) {
+        Test_Put (pixel, ((color >> 1) & 0x7FE0) | (color & 0x1F), 2);
+      } else {
+        pixel[0] = color >> 8;
+        pixel[1] = color & 0xFF;
+      }
+      fwrite (pixel, 1, bytes, file);
+    }
+    for (x = 0; x < padding; x++) {
+      fputc (0, file);
+    }
+  }
+  rewind (file);
+  return file;
+}
+
+/**
+ * @desc    Draw fixture and compare every pixel of screen
+ *
+ * @param   struct st7735 *
+ * @param   const char * name
+ * @param   enum test_format
+ * @param   uint16_t width
+ * @param   uint16_t height
+ * @param   uint8_t top-down rows
+ * @param   uint8_t x
+ * @param   uint8_t y
+ *
+ * @return  void
+ */
+static void Test_Image (struct st7735 * lcd, const char * name, enum test_format format, uint16_t width, uint16_t height, uint8_t topdown, uint8_t x, uint8_t y)
+{
+  uint8_t buffer[TEST_BLOCK];
+  struct st7735_storage storage = { .read = Test_Read, .context = NULL, .size = TEST_BLOCK, .buffer = buffer };
+  struct window clip = lcd->clip;
+  uint16_t expected;
+  uint16_t pixel;
+  uint16_t sx, sy;
+  uint32_t errors = 0;
+  uint8_t result;
+  int ix, iy;
+
+  // background, whole screen
+  ST7735_ResetClip (lcd);
+  ST7735_ClearScreen (lcd, TEST_BACKGROUND);
+  lcd->clip = clip;
+  storage.context = Test_Fixture (format, width, height, topdown);
+  blocks = 0;
+  if (format == TEST_RAW565) {
+    result = ST7735_Image_Raw565 (lcd, &storage, TEST_OFFSET, x, y, width, height);
+  } else {
+    result = ST7735_Image_BMP (lcd, &storage, TEST_OFFSET, x, y);
+  }
+  fclose (storage.context);
+  // loop through screen
+  for (sy = 0; sy < lcd->height; sy++) {
+    for (sx = 0; sx < lcd->width; sx++) {
+      ix = sx - x;
+      iy = sy - y;
+      expected = TEST_BACKGROUND;
+      // visible image pixel
+      if ((ix >= 0) && (iy >= 0) && (ix < width) && (iy < height) &&
+          (sx >= clip.x0) && (sx <= clip.x1) && (sy >= clip.y0) && (sy <= clip.y1)) {
+        expected = Test_Expected (Test_Color (ix, iy), format);
+      }
+      // framebuffer, or GRAM cell of screen pixel under rotation
+      pixel = lcd->fb ? lcd->fb->frame[sy * lcd->width + sx] : capture.gram[Capture_Cell (lcd->madctl, sx, sy)];
+      if (pixel != expected) {
+        errors++;
+      }
+    }
+  }
+  // rotation untouched
+  if (!lcd->fb && (capture.madctl != lcd->madctl)) {
+    errors++;
+  }
+  printf ("%-28s %-11s blocks %4u %s\n", name, lcd->fb ? "framebuffer" : "bus", blocks, (result == ST7735_SUCCESS) && !errors ? "ok" : "FAIL");
+  if ((result != ST7735_SUCCESS) || errors) {
+    failed++;
+  }
+}
+
+/**
+ * @desc    Main
+ *
+ * @param   void
+ *
+ * @return  int - 0 = all passed
+ */
+int main (void)
+{
+  static struct st7735_fb fb;
+  struct signal dc = { .pin = 1 };
+  struct signal rs = { .pin = 2 };
+  struct st7735 lcd = { .dc = &dc, .rs = &rs, .bus = &CAPTURE };
+  uint8_t i;
+
+  ST7735_SetRotation (&lcd, ROTATE_0);
+  capture.madctl = lcd.madctl;
+  ST7735_ResetClip (&lcd);
+  // through bus, then through framebuffer
+  for (i = 0; i < 2; i++) {
+    Test_Image (&lcd, "bmp 24 bit bottom-up", TEST_BGR888, 37, 23, 0, 5, 7);
+    Test_Image (&lcd, "bmp 565 bitfields", TEST_BMP565, 33, 19, 0, 20, 30);
+    Test_Image (&lcd, "bmp 555 top-down", TEST_BMP555, 31, 17, 1, 3, 50);
+    Test_Image (&lcd, "bmp 24 bit top-down odd", TEST_BGR888, 1, 5, 1, 100, 100);
+    Test_Image (&lcd, "bmp 24 bit partly off", TEST_BGR888, 50, 41, 0, 130, 100);
+    Test_Image (&lcd, "bmp 555 off-screen", TEST_BMP555, 21, 9, 0, 200, 200);
+    Test_Image (&lcd, "raw565 partly off", TEST_RAW565, 45, 30, 0, 140, 110);
+    // clip rectangle
+    ST7735_SetClip (&lcd, 20, 90, 10, 60);
+    Test_Image (&lcd, "bmp 24 bit clipped", TEST_BGR888, 37, 23, 0, 10, 40);
+    Test_Image (&lcd, "bmp 565 clipped top-down", TEST_BMP565, 35, 70, 1, 60, 0);
+    Test_Image (&lcd, "raw565 clipped", TEST_RAW565, 45, 30, 0, 60, 20);
+    ST7735_ResetClip (&lcd);
+    ST7735_FB_Init (&lcd, &fb);
+  }
+  return failed ? 1 : 0;
+}
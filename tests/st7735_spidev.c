@@ -0,0 +1,132 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - host test of spidev bus on mock device node
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       19.10.2026
+ * @file        st7735_spidev.c
+ * @version     2.0
+ * @tested      Linux (make test)
+ *
+ * @depend      lib/st7735.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Regular file and FIFO refuse SPI_IOC_MESSAGE, so ST7735_BUS_SPIDEV writes the
+ *              traffic into them; captured CASET / RASET / RAMWR bytes are compared with
+ *              expected ones. /dev/full and missing node check error reporting. Run by
+ *              'make test'.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "lib/st7735.h"
+
+/** @const Expected traffic of Test_Draw */
+static const uint8_t EXPECTED[] = {
+  // rotation
+  MADCTL, MADCTL_MY | MADCTL_MV,
+  // pixel 5, 6
+  CASET, 0x00, 0x05, 0x00, 0x05,
+  RASET, 0x00, 0x06, 0x00, 0x06,
+  RAMWR, 0xF8, 0x1F,
+  // line 1 - 3, 7
+  CASET, 0x00, 0x01, 0x00, 0x03,
+  RASET, 0x00, 0x07, 0x00, 0x07,
+  RAMWR, 0x12, 0x34, 0x12, 0x34, 0x12, 0x34
+};
+
+/** @var Failed checks */
+static int failed;
+
+/**
+ * @desc    Print and count result
+ *
+ * @param   const char * name
+ * @param   int passed
+ *
+ * @return  void
+ */
+static void Test_Result (const char * name, int passed)
+{
+  printf ("%-28s %s\n", name, passed ? "ok" : "FAIL");
+  if (!passed) {
+    failed++;
+  }
+}
+
+/**
+ * @desc    Open node and draw pixel and line
+ *
+ * @param   struct st7735 *
+ * @param   struct st7735_spidev *
+ * @param   const char * device
+ *
+ * @return  void
+ */
+static void Test_Draw (struct st7735 * lcd, struct st7735_spidev * spi, const char * device)
+{
+  spi->device = device;
+  lcd->bus->init (lcd);
+  ST7735_SetRotation (lcd, ROTATE_0);
+  ST7735_ResetClip (lcd);
+  ST7735_DrawPixel (lcd, 5, 6, 0xF81F);
+  ST7735_DrawLineHorizontal (lcd, 1, 3, 7, 0x1234);
+}
+
+/**
+ * @desc    Main
+ *
+ * @param   void
+ *
+ * @return  int - 0 = all passed
+ */
+int main (void)
+{
+  struct signal dc = { .pin = 24 };
+  struct signal rs = { .pin = 25 };
+  struct st7735_spidev spi = { .gpiochip = NULL, .speed = 8000000 };
+  struct st7735 lcd = { .dc = &dc, .rs = &rs, .bus = &ST7735_BUS_SPIDEV, .bus_data = &spi };
+  char path[] = "/tmp/st7735_spidev_XXXXXX";
+  uint8_t buffer[2 * sizeof (EXPECTED)];
+  ssize_t count;
+  int file;
+  int fifo;
+
+  // regular file
+  file = mkstemp (path);
+  Test_Draw (&lcd, &spi, path);
+  count = pread (file, buffer, sizeof (buffer), 0);
+  Test_Result ("regular file traffic", (spi.error == 0) && (count == sizeof (EXPECTED)) && !memcmp (buffer, EXPECTED, sizeof (EXPECTED)));
+  close (spi.fd);
+  close (file);
+  unlink (path);
+
+  // fifo, read end opened first so open of device does not block
+  mkfifo (path, 0600);
+  fifo = open (path, O_RDONLY | O_NONBLOCK);
+  Test_Draw (&lcd, &spi, path);
+  count = read (fifo, buffer, sizeof (buffer));
+  Test_Result ("fifo traffic", (spi.error == 0) && (count == sizeof (EXPECTED)) && !memcmp (buffer, EXPECTED, sizeof (EXPECTED)));
+  close (spi.fd);
+  close (fifo);
+  unlink (path);
+
+  // write fails
+  Test_Draw (&lcd, &spi, "/dev/full");
+  Test_Result ("write error reported", spi.error == ENOSPC);
+  close (spi.fd);
+
+  // open fails, drawing is dropped
+  Test_Draw (&lcd, &spi, "/nonexistent/spidev0.0");
+  Test_Result ("open error reported", (spi.fd < 0) && (spi.error == ENOENT));
+
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,384 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - animation encoder
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       19.10.2026
+ * @file        st7735_anim.c
+ * @version     2.0
+ * @tested      Linux
+ *
+ * @depend      lib/st7735_anim.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Encodes frame sequence into delta PROGMEM array for ST7735_Anim_Tick.
+ *              Usage: st7735_anim W H PERIOD frames.raw NAME > anim.c
+ *
+ *              frames.raw holds frames one after another, each W x H raw565 pixels high
+ *              byte first, top row first (as ST7735_Image_Raw565). PERIOD is milliseconds
+ *              per frame. Changed pixels of each row are joined into spans, spans touching
+ *              spans of row above grow rectangles; size and estimated SPI time of worst
+ *              frame at 8 MHz are reported to stderr.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lib/st7735_anim.h"
+
+// unchanged pixels between changed ones joined into one span / rectangle, window
+// costs about as much as 8 pixels (CASET, RASET, RAMWR and rectangle header)
+#define GAP             8
+// bytes of window commands on wire
+#define WINDOW_BYTES    11
+// SPI clock
+#define SPI_HZ          8000000UL
+
+/** @struct Rectangle, inclusive */
+struct rect {
+  unsigned x0, x1, y0, y1;
+};
+
+/** @struct Growing byte array */
+struct bytes {
+  unsigned char * data;
+  size_t length;
+  size_t size;
+};
+
+/** @struct Encoded frame */
+struct frame {
+  struct bytes code;
+  unsigned rects;
+  unsigned long pixels;
+};
+
+/**
+ * @desc    Report error and quit
+ *
+ * @param   const char * message
+ *
+ * @return  void
+ */
+static void Fail (const char * message)
+{
+  fprintf (stderr, "st7735_anim: %s\n", message);
+  exit (1);
+}
+
+/**
+ * @desc    Append byte
+ *
+ * @param   struct bytes *
+ * @param   unsigned value
+ *
+ * @return  void
+ */
+static void Put (struct bytes * b, unsigned value)
+{
+  // grow twice
+  if (b->length == b->size) {
+    b->size = b->size ? b->size * 2 : 256;
+    b->data = realloc (b->data, b->size);
+    if (b->data == NULL) {
+      Fail ("out of memory");
+    }
+  }
+  b->data[b->length++] = (unsigned char) value;
+}
+
+/**
+ * @desc    Find changed rectangles
+ *
+ * @param   const uint16_t * previous frame, NULL = everything changed
+ * @param   const uint16_t * current frame
+ * @param   unsigned w
+ * @param   unsigned h
+ * @param   struct rect * - room for w * h rectangles
+ *
+ * @return  unsigned - count
+ */
+static unsigned Changes (const uint16_t * prev, const uint16_t * cur, unsigned w, unsigned h, struct rect * rects)
+{
+  unsigned count = 0;
+  unsigned x, y, i, j;
+  unsigned x0, x1;
+  int merged;
+
+  // whole frame
+  if (prev == NULL) {
+    rects[0] = (struct rect) { 0, w - 1, 0, h - 1 };
+    return 1;
+  }
+  // loop through rows
+  for (y = 0; y < h; y++) {
+    x = 0;
+    while (x < w) {
+      // first changed pixel
+      while ((x < w) && (prev[y * w + x] == cur[y * w + x])) {
+        x++;
+      }
+      if (x == w) {
+        break;
+      }
+      // span up to gap of unchanged pixels
+      x0 = x1 = x;
+      for (x++; (x < w) && (x <= x1 + GAP); x++) {
+        if (prev[y * w + x] != cur[y * w + x]) {
+          x1 = x;
+        }
+      }
+      x = x1 + 1;
+      // grow rectangle ending in row above
+      merged = -1;
+      for (i = 0; i < count; i++) {
+        if ((rects[i].y1 + 1 >= y) && (rects[i].x0 <= x1 + GAP) && (x0 <= rects[i].x1 + GAP)) {
+          if (merged < 0) {
+            merged = i;
+            rects[i].x0 = (rects[i].x0 < x0) ? rects[i].x0 : x0;
+            rects[i].x1 = (rects[i].x1 > x1) ? rects[i].x1 : x1;
+            rects[i].y1 = y;
+          } else {
+            // span joins two rectangles
+            rects[merged].x0 = (rects[merged].x0 < rects[i].x0) ? rects[merged].x0 : rects[i].x0;
+            rects[merged].x1 = (rects[merged].x1 > rects[i].x1) ? rects[merged].x1 : rects[i].x1;
+            rects[merged].y0 = (rects[merged].y0 < rects[i].y0) ? rects[merged].y0 : rects[i].y0;
+            rects[i--] = rects[--count];
+          }
+        }
+      }
+      // new rectangle
+      if (merged < 0) {
+        rects[count++] = (struct rect) { x0, x1, y, y };
+      }
+    }
+  }
+  // grown rectangles may overlap, join them
+  for (i = 0; i < count; i++) {
+    for (j = i + 1; j < count; j++) {
+      if ((rects[i].x0 <= rects[j].x1) && (rects[j].x0 <= rects[i].x1) &&
+          (rects[i].y0 <= rects[j].y1) && (rects[j].y0 <= rects[i].y1)) {
+        rects[i].x0 = (rects[i].x0 < rects[j].x0) ? rects[i].x0 : rects[j].x0;
+        rects[i].x1 = (rects[i].x1 > rects[j].x1) ? rects[i].x1 : rects[j].x1;
+        rects[i].y0 = (rects[i].y0 < rects[j].y0) ? rects[i].y0 : rects[j].y0;
+        rects[i].y1 = (rects[i].y1 > rects[j].y1) ? rects[i].y1 : rects[j].y1;
+        rects[j] = rects[--count];
+        // start over with grown one
+        j = i;
+      }
+    }
+  }
+  // too many for one frame, bounding box
+  if (count > 255) {
+    for (i = 1; i < count; i++) {
+      rects[0].x0 = (rects[0].x0 < rects[i].x0) ? rects[0].x0 : rects[i].x0;
+      rects[0].x1 = (rects[0].x1 > rects[i].x1) ? rects[0].x1 : rects[i].x1;
+      rects[0].y0 = (rects[0].y0 < rects[i].y0) ? rects[0].y0 : rects[i].y0;
+      rects[0].y1 = (rects[0].y1 > rects[i].y1) ? rects[0].y1 : rects[i].y1;
+    }
+    count = 1;
+  }
+  return count;
+}
+
+/**
+ * @desc    Encode rectangle pixels RLE
+ *
+ * @param   struct bytes *
+ * @param   const uint16_t * frame
+ * @param   unsigned w - frame width
+ * @param   const struct rect *
+ *
+ * @return  void
+ */
+static void Encode (struct bytes * b, const uint16_t * frame, unsigned w, const struct rect * r)
+{
+  unsigned rw = r->x1 - r->x0 + 1;
+  unsigned long n = (unsigned long) rw * (r->y1 - r->y0 + 1);
+  uint16_t * pixels;
+  uint8_t * out;
+  unsigned long length;
+  unsigned long k;
+
+  // rectangle in burst order
+  pixels = malloc (n * sizeof (uint16_t));
+  out = malloc (ST7735_RLE_BOUND (n));
+  if ((pixels == NULL) || (out == NULL)) {
+    Fail ("out of memory");
+  }
+  for (k = 0; k < n; k++) {
+    pixels[k] = frame[(r->y0 + k / rw) * w + r->x0 + k % rw];
+  }
+  length = ST7735_RLE_Encode (out, pixels, n);
+  for (k = 0; k < length; k++) {
+    Put (b, out[k]);
+  }
+  free (out);
+  free (pixels);
+}
+
+/**
+ * @desc    Encode frame as changes against previous one
+ *
+ * @param   struct frame *
+ * @param   const uint16_t * previous, NULL = whole
+ * @param   const uint16_t * current
+ * @param   unsigned w
+ * @param   unsigned h
+ * @param   struct rect * - scratch
+ *
+ * @return  void
+ */
+static void Delta (struct frame * f, const uint16_t * prev, const uint16_t * cur, unsigned w, unsigned h, struct rect * rects)
+{
+  unsigned i;
+
+  memset (f, 0, sizeof (*f));
+  f->rects = Changes (prev, cur, w, h, rects);
+  Put (&f->code, f->rects);
+  // hold 1 period
+  Put (&f->code, 1);
+  for (i = 0; i < f->rects; i++) {
+    Put (&f->code, rects[i].x0);
+    Put (&f->code, rects[i].y0);
+    Put (&f->code, rects[i].x1 - rects[i].x0 + 1);
+    Put (&f->code, rects[i].y1 - rects[i].y0 + 1);
+    Encode (&f->code, cur, w, &rects[i]);
+    f->pixels += (unsigned long) (rects[i].x1 - rects[i].x0 + 1) * (rects[i].y1 - rects[i].y0 + 1);
+  }
+}
+
+/**
+ * @desc    Print frame as C bytes
+ *
+ * @param   const struct frame *
+ * @param   const char * comment
+ *
+ * @return  void
+ */
+static void Print (const struct frame * f, const char * comment)
+{
+  size_t i;
+
+  printf ("  // %s: %u rects, %lu pixels\n", comment, f->rects, f->pixels);
+  for (i = 0; i < f->code.length; i++) {
+    printf ("%s0x%02X,%s", (i % 12) ? " " : "  ", f->code.data[i], ((i % 12 == 11) || (i + 1 == f->code.length)) ? "\n" : "");
+  }
+}
+
+/**
+ * @desc    Encode animation
+ *
+ * @param   int argc
+ * @param   char ** argv
+ *
+ * @return  int
+ */
+int main (int argc, char ** argv)
+{
+  struct frame * frames = NULL;
+  struct frame wrap;
+  struct rect * rects;
+  unsigned char * raw;
+  uint16_t * pixels;
+  unsigned long size, total, wire, worst = 0;
+  unsigned long read, count, i, n = 0;
+  unsigned w, h, period, hold, slowest = 0;
+  char comment[32];
+  FILE * file;
+
+  if (argc != 6) {
+    fprintf (stderr, "usage: %s W H PERIOD frames.raw NAME > anim.c\n", argv[0]);
+    return 1;
+  }
+  w = strtoul (argv[1], NULL, 0);
+  h = strtoul (argv[2], NULL, 0);
+  period = strtoul (argv[3], NULL, 0);
+  if ((w == 0) || (w > 255) || (h == 0) || (h > 255) || (period == 0) || (period > ST7735_ANIM_SPAN)) {
+    Fail ("W, H 1 - 255, PERIOD 1 - 32767 ms");
+  }
+  // longest hold player can wait for
+  hold = ST7735_ANIM_SPAN / period;
+  hold = (hold > 255) ? 255 : hold;
+  file = fopen (argv[4], "rb");
+  if (file == NULL) {
+    perror (argv[4]);
+    return 1;
+  }
+  // all frames converted from wire order
+  size = (unsigned long) w * h;
+  raw = malloc (size * 2);
+  pixels = NULL;
+  rects = malloc (size * sizeof (struct rect));
+  if ((raw == NULL) || (rects == NULL)) {
+    Fail ("out of memory");
+  }
+  for (count = 0; (read = fread (raw, 2, size, file)) == size; count++) {
+    pixels = realloc (pixels, (count + 1) * size * sizeof (uint16_t));
+    if (pixels == NULL) {
+      Fail ("out of memory");
+    }
+    for (i = 0; i < size; i++) {
+      pixels[count * size + i] = (raw[2 * i] << 8) | raw[2 * i + 1];
+    }
+  }
+  fclose (file);
+  if ((read != 0) || (count == 0)) {
+    Fail ("file is not whole number of frames");
+  }
+  // deltas, identical frames prolong previous one up to longest hold
+  frames = calloc (count, sizeof (struct frame));
+  if (frames == NULL) {
+    Fail ("out of memory");
+  }
+  for (i = 0; i < count; i++) {
+    Delta (&frames[n], i ? &pixels[(i - 1) * size] : NULL, &pixels[i * size], w, h, rects);
+    if ((i > 0) && (frames[n].rects == 0) && (frames[n - 1].code.data[1] < hold)) {
+      frames[n - 1].code.data[1]++;
+      free (frames[n].code.data);
+    } else {
+      n++;
+    }
+  }
+  if (n > 0xFFFF) {
+    Fail ("too many frames");
+  }
+  // back from last frame to first one, shown as long as first one
+  Delta (&wrap, &pixels[(count - 1) * size], pixels, w, h, rects);
+  wrap.code.data[1] = frames[0].code.data[1];
+
+  printf ("// Generated by tools/st7735_anim from %s, do not edit\n\n", argv[4]);
+  printf ("#include \"lib/st7735_anim.h\"\n\n");
+  printf ("const uint8_t %s[] PROGMEM = {\n", argv[5]);
+  printf ("  // %u x %u, %u ms, %lu frames\n", w, h, period, n);
+  printf ("  0x%02X, 0x%02X, 0x%02X, 0x%02X, 0x%02X, 0x%02X,\n", w, h, period >> 8, period & 0xFF, (unsigned) (n >> 8), (unsigned) (n & 0xFF));
+  total = ST7735_ANIM_HEADER;
+  for (i = 0; i < n; i++) {
+    snprintf (comment, sizeof (comment), "frame %lu", i);
+    Print (&frames[i], comment);
+    total += frames[i].code.length;
+    // worst delta, first frame is drawn once
+    wire = frames[i].pixels * 2 + frames[i].rects * WINDOW_BYTES;
+    if ((i > 0) && (wire > worst)) {
+      worst = wire;
+      slowest = i;
+    }
+  }
+  Print (&wrap, "wrap");
+  total += wrap.code.length;
+  printf ("};\n");
+
+  // size report
+  fprintf (stderr, "%s: %lu frames, %lu bytes (raw %lu)\n", argv[5], n, total, count * size * 2);
+  if (worst) {
+    fprintf (stderr, "%s: worst frame %u, %u rects, %lu pixels, ~%lu us on %lu MHz SPI\n",
+      argv[5], slowest, frames[slowest].rects, frames[slowest].pixels, worst * 8 * 1000000UL / SPI_HZ, SPI_HZ / 1000000UL);
+    if (worst * 8 * 1000UL / SPI_HZ > period) {
+      fprintf (stderr, "%s: worst frame longer than period\n", argv[5]);
+    }
+  }
+  return 0;
+}
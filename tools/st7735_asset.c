@@ -0,0 +1,992 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - PNG asset converter
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       19.10.2026
+ * @file        st7735_asset.c
+ * @version     2.0
+ * @tested      Linux
+ *
+ * @depend      lib/st7735_asset.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Converts PNG into PROGMEM array for ST7735_Asset_Draw in the smallest of raw565,
+ *              palette (1, 2, 4, 8 bits, 1 bit = 1bpp image) and RLE, and reports flash
+ *              and SPI bytes of every format to stderr.
+ *              Usage: st7735_asset [options] input.png [NAME] > asset.c
+ *
+ *                -f raw|palette|rle          force format
+ *                -c colors                   reduce to 2 - 256 colors (median cut)
+ *                -d none|ordered|fs          dithering of color reduction, 888 -> 565 too
+ *                -b RRGGBB                   background of transparent pixels
+ *
+ *              NAME defaults to upper case file name. Any PNG without interlace is read;
+ *              inflate is built in, so the tool needs no zlib.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lib/st7735_asset.h"
+
+// bytes of window commands on wire (CASET, RASET, RAMWR)
+#define WINDOW_BYTES    11
+
+/** @enum Dithering */
+enum dither {
+  DITHER_NONE,
+  DITHER_ORDERED,
+  DITHER_FS
+};
+
+/** @struct Growing byte array */
+struct bytes {
+  unsigned char * data;
+  size_t length;
+  size_t size;
+};
+
+/** @struct Inflate state */
+struct inflate {
+  // compressed
+  const unsigned char * in;
+  size_t length;
+  size_t position;
+  // bits not used yet
+  unsigned long buffer;
+  unsigned count;
+  // decompressed, size known from header
+  unsigned char * out;
+  size_t size;
+  size_t written;
+};
+
+/** @struct Canonical Huffman code */
+struct huffman {
+  // codes of each length
+  unsigned short count[16];
+  // symbols ordered by code
+  unsigned short symbol[288];
+};
+
+/** @struct Image, RGB 888 */
+struct image {
+  unsigned width;
+  unsigned height;
+  unsigned char * rgb;
+};
+
+/**
+ * @desc    Report error and quit
+ *
+ * @param   const char * message
+ *
+ * @return  void
+ */
+static void Fail (const char * message)
+{
+  fprintf (stderr, "st7735_asset: %s\n", message);
+  exit (1);
+}
+
+/**
+ * @desc    Allocate or quit
+ *
+ * @param   size_t
+ *
+ * @return  void *
+ */
+static void * Alloc (size_t size)
+{
+  void * memory = calloc (1, size ? size : 1);
+
+  if (memory == NULL) {
+    Fail ("out of memory");
+  }
+  return memory;
+}
+
+/**
+ * @desc    Append byte
+ *
+ * @param   struct bytes *
+ * @param   unsigned value
+ *
+ * @return  void
+ */
+static void Put (struct bytes * b, unsigned value)
+{
+  // grow twice
+  if (b->length == b->size) {
+    b->size = b->size ? b->size * 2 : 1024;
+    b->data = realloc (b->data, b->size);
+    if (b->data == NULL) {
+      Fail ("out of memory");
+    }
+  }
+  b->data[b->length++] = (unsigned char) value;
+}
+
+/**
+ * @desc    Append color, high byte first
+ *
+ * @param   struct bytes *
+ * @param   unsigned color
+ *
+ * @return  void
+ */
+static void PutColor (struct bytes * b, unsigned color)
+{
+  Put (b, color >> 8);
+  Put (b, color);
+}
+
+/**
+ * @desc    Read bits of deflate stream, LSB first
+ *
+ * @param   struct inflate *
+ * @param   unsigned n
+ *
+ * @return  unsigned
+ */
+static unsigned Bits (struct inflate * s, unsigned n)
+{
+  unsigned value;
+
+  while (s->count < n) {
+    if (s->position == s->length) {
+      Fail ("compressed data truncated");
+    }
+    s->buffer |= (unsigned long) s->in[s->position++] << s->count;
+    s->count += 8;
+  }
+  value = s->buffer & ((1UL << n) - 1);
+  s->buffer >>= n;
+  s->count -= n;
+  return value;
+}
+
+/**
+ * @desc    Build canonical code from code lengths
+ *
+ * @param   struct huffman *
+ * @param   const unsigned char * lengths
+ * @param   unsigned n - symbols
+ *
+ * @return  void
+ */
+static void Build (struct huffman * h, const unsigned char * lengths, unsigned n)
+{
+  unsigned short offset[16];
+  unsigned i;
+
+  memset (h->count, 0, sizeof (h->count));
+  for (i = 0; i < n; i++) {
+    h->count[lengths[i]]++;
+  }
+  h->count[0] = 0;
+  // first symbol of each length
+  offset[1] = 0;
+  for (i = 1; i < 15; i++) {
+    offset[i + 1] = offset[i] + h->count[i];
+  }
+  for (i = 0; i < n; i++) {
+    if (lengths[i]) {
+      h->symbol[offset[lengths[i]]++] = i;
+    }
+  }
+}
+
+/**
+ * @desc    Decode symbol bit by bit
+ *
+ * @param   struct inflate *
+ * @param   const struct huffman *
+ *
+ * @return  unsigned
+ */
+static unsigned Decode (struct inflate * s, const struct huffman * h)
+{
+  int code = 0;
+  int first = 0;
+  int index = 0;
+  unsigned length;
+
+  for (length = 1; length < 16; length++) {
+    code |= Bits (s, 1);
+    // code of this length
+    if (code - first < h->count[length]) {
+      return h->symbol[index + (code - first)];
+    }
+    index += h->count[length];
+    first = (first + h->count[length]) << 1;
+    code <<= 1;
+  }
+  Fail ("invalid Huffman code");
+  return 0;
+}
+
+/**
+ * @desc    Decode block of literals and matches
+ *
+ * @param   struct inflate *
+ * @param   const struct huffman * literals and lengths
+ * @param   const struct huffman * distances
+ *
+ * @return  void
+ */
+static void Codes (struct inflate * s, const struct huffman * lit, const struct huffman * dist)
+{
+  static const unsigned short base[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+  static const unsigned char extra[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+  static const unsigned short dbase[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+  static const unsigned char dextra[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+  unsigned symbol;
+  size_t length;
+  size_t distance;
+
+  while ((symbol = Decode (s, lit)) != 256) {
+    // literal
+    if (symbol < 256) {
+      if (s->written == s->size) {
+        Fail ("image data too long");
+      }
+      s->out[s->written++] = symbol;
+      continue;
+    }
+    // match
+    symbol -= 257;
+    if (symbol >= 29) {
+      Fail ("invalid length code");
+    }
+    length = base[symbol] + Bits (s, extra[symbol]);
+    symbol = Decode (s, dist);
+    if (symbol >= 30) {
+      Fail ("invalid distance code");
+    }
+    distance = dbase[symbol] + Bits (s, dextra[symbol]);
+    if ((distance > s->written) || (length > s->size - s->written)) {
+      Fail ("invalid match");
+    }
+    while (length--) {
+      s->out[s->written] = s->out[s->written - distance];
+      s->written++;
+    }
+  }
+}
+
+/**
+ * @desc    Inflate zlib stream into buffer of known size
+ *
+ * @param   struct inflate *
+ *
+ * @return  void
+ */
+static void Inflate (struct inflate * s)
+{
+  static const unsigned char order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+  unsigned char lengths[320];
+  struct huffman lit, dist;
+  unsigned last, type;
+  unsigned nlen, ndist, ncode;
+  unsigned i, symbol, repeat;
+  size_t stored;
+
+  // zlib header, deflate without dictionary
+  if ((s->length < 2) || ((s->in[0] & 0x0F) != 8) || (((s->in[0] << 8) | s->in[1]) % 31) || (s->in[1] & 0x20)) {
+    Fail ("invalid zlib header");
+  }
+  s->position = 2;
+  do {
+    last = Bits (s, 1);
+    type = Bits (s, 2);
+    // stored
+    if (type == 0) {
+      s->buffer = 0;
+      s->count = 0;
+      if (s->position + 4 > s->length) {
+        Fail ("compressed data truncated");
+      }
+      stored = s->in[s->position] | (s->in[s->position + 1] << 8);
+      s->position += 4;
+      if ((s->position + stored > s->length) || (stored > s->size - s->written)) {
+        Fail ("invalid stored block");
+      }
+      memcpy (s->out + s->written, s->in + s->position, stored);
+      s->position += stored;
+      s->written += stored;
+    // fixed codes
+    } else if (type == 1) {
+      for (i = 0; i < 288; i++) {
+        lengths[i] = (i < 144) ? 8 : (i < 256) ? 9 : (i < 280) ? 7 : 8;
+      }
+      Build (&lit, lengths, 288);
+      memset (lengths, 5, 30);
+      Build (&dist, lengths, 30);
+      Codes (s, &lit, &dist);
+    // dynamic codes
+    } else if (type == 2) {
+      nlen = Bits (s, 5) + 257;
+      ndist = Bits (s, 5) + 1;
+      ncode = Bits (s, 4) + 4;
+      memset (lengths, 0, sizeof (lengths));
+      for (i = 0; i < ncode; i++) {
+        lengths[order[i]] = Bits (s, 3);
+      }
+      Build (&lit, lengths, 19);
+      // code lengths of both codes
+      for (i = 0; i < nlen + ndist; ) {
+        symbol = Decode (s, &lit);
+        if (symbol < 16) {
+          lengths[i++] = symbol;
+          continue;
+        }
+        if ((symbol == 16) && (i == 0)) {
+          Fail ("invalid code lengths");
+        }
+        repeat = (symbol == 16) ? 3 + Bits (s, 2) : (symbol == 17) ? 3 + Bits (s, 3) : 11 + Bits (s, 7);
+        if (i + repeat > nlen + ndist) {
+          Fail ("invalid code lengths");
+        }
+        memset (lengths + i, (symbol == 16) ? lengths[i - 1] : 0, repeat);
+        i += repeat;
+      }
+      Build (&lit, lengths, nlen);
+      Build (&dist, lengths + nlen, ndist);
+      Codes (s, &lit, &dist);
+    } else {
+      Fail ("invalid block type");
+    }
+  } while (!last);
+}
+
+/**
+ * @desc    Big endian 32 bits
+ *
+ * @param   const unsigned char *
+ *
+ * @return  unsigned long
+ */
+static unsigned long Long (const unsigned char * p)
+{
+  return ((unsigned long) p[0] << 24) | ((unsigned long) p[1] << 16) | ((unsigned long) p[2] << 8) | p[3];
+}
+
+/**
+ * @desc    Paeth predictor
+ *
+ * @param   int a - left
+ * @param   int b - up
+ * @param   int c - up left
+ *
+ * @return  int
+ */
+static int Paeth (int a, int b, int c)
+{
+  int p = a + b - c;
+  int pa = abs (p - a);
+  int pb = abs (p - b);
+  int pc = abs (p - c);
+
+  return ((pa <= pb) && (pa <= pc)) ? a : (pb <= pc) ? b : c;
+}
+
+/**
+ * @desc    Load PNG, transparent pixels over background
+ *
+ * @param   const char * file name
+ * @param   unsigned long background - RRGGBB
+ * @param   struct image *
+ *
+ * @return  void
+ */
+static void Load (const char * name, unsigned long background, struct image * img)
+{
+  static const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+  unsigned char palette[256][4];
+  unsigned char * file;
+  struct bytes idat = { 0 };
+  struct inflate s = { 0 };
+  unsigned char * row, * prev;
+  unsigned long length;
+  size_t size, pos, i;
+  unsigned depth = 0, type = 0, channels = 0, bpp, stride;
+  unsigned x, y, c, filter, sample, v;
+  unsigned rgba[4];
+  FILE * f;
+
+  f = fopen (name, "rb");
+  if (f == NULL) {
+    perror (name);
+    exit (1);
+  }
+  fseek (f, 0, SEEK_END);
+  size = ftell (f);
+  fseek (f, 0, SEEK_SET);
+  file = Alloc (size);
+  if (fread (file, 1, size, f) != size) {
+    Fail ("read error");
+  }
+  fclose (f);
+  if ((size < 8) || memcmp (file, signature, 8)) {
+    Fail ("not a PNG file");
+  }
+  // opaque palette
+  for (i = 0; i < 256; i++) {
+    palette[i][3] = 255;
+  }
+  // chunks
+  img->width = 0;
+  for (pos = 8; pos + 12 <= size; pos += length + 12) {
+    length = Long (file + pos);
+    if (length > size - pos - 12) {
+      Fail ("chunk truncated");
+    }
+    if (!memcmp (file + pos + 4, "IHDR", 4) && (length >= 13)) {
+      img->width = Long (file + pos + 8);
+      img->height = Long (file + pos + 12);
+      depth = file[pos + 16];
+      type = file[pos + 17];
+      if (file[pos + 20]) {
+        Fail ("interlaced PNG not supported, save without interlace");
+      }
+    } else if (!memcmp (file + pos + 4, "PLTE", 4)) {
+      for (i = 0; (i < length / 3) && (i < 256); i++) {
+        memcpy (palette[i], file + pos + 8 + i * 3, 3);
+      }
+    } else if (!memcmp (file + pos + 4, "tRNS", 4) && (type == 3)) {
+      for (i = 0; (i < length) && (i < 256); i++) {
+        palette[i][3] = file[pos + 8 + i];
+      }
+    } else if (!memcmp (file + pos + 4, "IDAT", 4)) {
+      for (i = 0; i < length; i++) {
+        Put (&idat, file[pos + 8 + i]);
+      }
+    } else if (!memcmp (file + pos + 4, "IEND", 4)) {
+      break;
+    }
+  }
+  // gray, -, RGB, indexed, gray alpha, -, RGBA
+  channels = (type == 0) ? 1 : (type == 2) ? 3 : (type == 3) ? 1 : (type == 4) ? 2 : (type == 6) ? 4 : 0;
+  if ((img->width == 0) || (img->height == 0) || (channels == 0) || (idat.length == 0) ||
+      ((depth != 1) && (depth != 2) && (depth != 4) && (depth != 8) && (depth != 16))) {
+    Fail ("unsupported PNG");
+  }
+  if ((img->width > 255) || (img->height > 255)) {
+    Fail ("image larger than 255 x 255");
+  }
+  // filtered rows
+  stride = (img->width * channels * depth + 7) / 8;
+  bpp = (channels * depth + 7) / 8;
+  s.in = idat.data;
+  s.length = idat.length;
+  s.size = (size_t) (stride + 1) * img->height;
+  s.out = Alloc (s.size);
+  Inflate (&s);
+  if (s.written != s.size) {
+    Fail ("image data too short");
+  }
+  // unfilter in place
+  img->rgb = Alloc ((size_t) img->width * img->height * 3);
+  prev = NULL;
+  for (y = 0; y < img->height; y++) {
+    row = s.out + (size_t) y * (stride + 1);
+    filter = row[0];
+    row++;
+    for (i = 0; i < stride; i++) {
+      unsigned a = (i >= bpp) ? row[i - bpp] : 0;
+      unsigned b = prev ? prev[i] : 0;
+      unsigned cc = (prev && (i >= bpp)) ? prev[i - bpp] : 0;
+      if (filter == 1) {
+        row[i] += a;
+      } else if (filter == 2) {
+        row[i] += b;
+      } else if (filter == 3) {
+        row[i] += (a + b) >> 1;
+      } else if (filter == 4) {
+        row[i] += Paeth (a, b, cc);
+      } else if (filter != 0) {
+        Fail ("invalid filter");
+      }
+    }
+    // samples to RGB over background
+    for (x = 0; x < img->width; x++) {
+      for (c = 0; c < channels; c++) {
+        // sample scaled to 8 bits
+        if (depth == 16) {
+          sample = row[(x * channels + c) * 2];
+        } else if (depth == 8) {
+          sample = row[x * channels + c];
+        } else {
+          v = x * depth;
+          sample = (row[v >> 3] >> (8 - depth - (v & 7))) & ((1 << depth) - 1);
+          if (type != 3) {
+            sample = sample * 255 / ((1 << depth) - 1);
+          }
+        }
+        rgba[c] = sample;
+      }
+      if (type == 3) {
+        v = rgba[0];
+        for (c = 0; c < 4; c++) {
+          rgba[c] = palette[v][c];
+        }
+      } else if (channels <= 2) {
+        rgba[3] = (channels == 2) ? rgba[1] : 255;
+        rgba[1] = rgba[2] = rgba[0];
+      } else if (channels == 3) {
+        rgba[3] = 255;
+      }
+      for (c = 0; c < 3; c++) {
+        v = (background >> (16 - 8 * c)) & 0xFF;
+        img->rgb[((size_t) y * img->width + x) * 3 + c] = (rgba[c] * rgba[3] + v * (255 - rgba[3]) + 127) / 255;
+      }
+    }
+    prev = row;
+  }
+  free (s.out);
+  free (idat.data);
+  free (file);
+}
+
+/**
+ * @desc    888 components of 565 color, low bits replicated
+ *
+ * @param   unsigned color
+ * @param   int * rgb
+ *
+ * @return  void
+ */
+static void Color888 (unsigned color, int * rgb)
+{
+  rgb[0] = ((color >> 11) << 3) | (color >> 13);
+  rgb[1] = (((color >> 5) & 0x3F) << 2) | ((color >> 9) & 0x03);
+  rgb[2] = ((color & 0x1F) << 3) | ((color >> 2) & 0x07);
+}
+
+/**
+ * @desc    Nearest color, palette NULL = nearest 565 color
+ *
+ * @param   const int * rgb
+ * @param   const unsigned * palette of 565 colors
+ * @param   unsigned count
+ *
+ * @return  unsigned - 565 color
+ */
+static unsigned Nearest (const int * rgb, const unsigned * palette, unsigned count)
+{
+  static const int levels[3] = { 31, 63, 31 };
+  unsigned best = 0;
+  long distance, nearest = -1;
+  int q[3], c, i;
+  unsigned k;
+
+  // rounding to levels of 565
+  if (palette == NULL) {
+    for (i = 0; i < 3; i++) {
+      c = (rgb[i] < 0) ? 0 : (rgb[i] > 255) ? 255 : rgb[i];
+      q[i] = (c * levels[i] + 127) / 255;
+    }
+    return (q[0] << 11) | (q[1] << 5) | q[2];
+  }
+  for (k = 0; k < count; k++) {
+    Color888 (palette[k], q);
+    distance = 0;
+    for (i = 0; i < 3; i++) {
+      distance += (long) (rgb[i] - q[i]) * (rgb[i] - q[i]);
+    }
+    if ((nearest < 0) || (distance < nearest)) {
+      nearest = distance;
+      best = palette[k];
+    }
+  }
+  return best;
+}
+
+/** @var Channel of median cut sort */
+static int sort_channel;
+
+/**
+ * @desc    Compare pixels by channel
+ *
+ * @param   const void *
+ * @param   const void *
+ *
+ * @return  int
+ */
+static int Compare (const void * a, const void * b)
+{
+  return ((const unsigned char *) a)[sort_channel] - ((const unsigned char *) b)[sort_channel];
+}
+
+/**
+ * @desc    Median cut palette
+ *
+ * @param   const struct image *
+ * @param   unsigned colors
+ * @param   unsigned * palette
+ *
+ * @return  unsigned - colors of palette
+ */
+static unsigned MedianCut (const struct image * img, unsigned colors, unsigned * palette)
+{
+  size_t n = (size_t) img->width * img->height;
+  unsigned char * pixels = Alloc (n * 3);
+  size_t start[256], end[256];
+  unsigned boxes = 1;
+  unsigned b, best, channel, k;
+  int range, widest, lo[3], hi[3];
+  int rgb[3];
+  size_t i, sum[3];
+
+  memcpy (pixels, img->rgb, n * 3);
+  start[0] = 0;
+  end[0] = n;
+  while (boxes < colors) {
+    // box with widest channel
+    widest = 0;
+    best = channel = 0;
+    for (b = 0; b < boxes; b++) {
+      for (k = 0; k < 3; k++) {
+        lo[k] = 255;
+        hi[k] = 0;
+      }
+      for (i = start[b]; i < end[b]; i++) {
+        for (k = 0; k < 3; k++) {
+          lo[k] = (pixels[i * 3 + k] < lo[k]) ? pixels[i * 3 + k] : lo[k];
+          hi[k] = (pixels[i * 3 + k] > hi[k]) ? pixels[i * 3 + k] : hi[k];
+        }
+      }
+      for (k = 0; k < 3; k++) {
+        range = hi[k] - lo[k];
+        if (range > widest) {
+          widest = range;
+          best = b;
+          channel = k;
+        }
+      }
+    }
+    // all boxes of one color
+    if (widest == 0) {
+      break;
+    }
+    // split at median
+    sort_channel = channel;
+    qsort (pixels + start[best] * 3, end[best] - start[best], 3, Compare);
+    i = start[best] + (end[best] - start[best]) / 2;
+    // keep equal values in one box
+    while ((i > start[best]) && (pixels[i * 3 + channel] == pixels[(i - 1) * 3 + channel])) {
+      i--;
+    }
+    if (i == start[best]) {
+      i = start[best] + (end[best] - start[best]) / 2;
+      while ((i < end[best]) && (pixels[i * 3 + channel] == pixels[(i - 1) * 3 + channel])) {
+        i++;
+      }
+    }
+    start[boxes] = i;
+    end[boxes] = end[best];
+    end[best] = i;
+    boxes++;
+  }
+  // averages
+  for (b = 0; b < boxes; b++) {
+    sum[0] = sum[1] = sum[2] = 0;
+    for (i = start[b]; i < end[b]; i++) {
+      for (k = 0; k < 3; k++) {
+        sum[k] += pixels[i * 3 + k];
+      }
+    }
+    for (k = 0; k < 3; k++) {
+      rgb[k] = (sum[k] + (end[b] - start[b]) / 2) / (end[b] - start[b]);
+    }
+    palette[b] = Nearest (rgb, NULL, 0);
+  }
+  free (pixels);
+  return boxes;
+}
+
+/**
+ * @desc    Reduce image to 565 or palette with dithering
+ *
+ * @param   const struct image *
+ * @param   const unsigned * palette, NULL = all 565 colors
+ * @param   unsigned count
+ * @param   enum dither
+ * @param   unsigned * pixels - 565
+ *
+ * @return  void
+ */
+static void Reduce (const struct image * img, const unsigned * palette, unsigned count, enum dither dither, unsigned * pixels)
+{
+  // Bayer 4 x 4
+  static const int bayer[4][4] = { { 0, 8, 2, 10 }, { 12, 4, 14, 6 }, { 3, 11, 1, 9 }, { 15, 7, 13, 5 } };
+  unsigned w = img->width;
+  unsigned h = img->height;
+  // error of Floyd-Steinberg, rows y and y + 1 with margins
+  int * error = Alloc ((size_t) (w + 2) * 2 * 3 * sizeof (int));
+  int * here, * next;
+  int rgb[3], q[3], spread[3];
+  unsigned x, y, k;
+
+  // step between levels
+  for (k = 0; k < 3; k++) {
+    spread[k] = palette ? 256 / (count < 8 ? 2 : count < 64 ? 4 : 6) : (k == 1) ? 4 : 8;
+  }
+  for (y = 0; y < h; y++) {
+    here = error + ((y & 1) ? (w + 2) * 3 : 0);
+    next = error + ((y & 1) ? 0 : (w + 2) * 3);
+    memset (next, 0, (w + 2) * 3 * sizeof (int));
+    for (x = 0; x < w; x++) {
+      for (k = 0; k < 3; k++) {
+        rgb[k] = img->rgb[((size_t) y * w + x) * 3 + k];
+        if (dither == DITHER_ORDERED) {
+          rgb[k] += (2 * bayer[y & 3][x & 3] - 15) * spread[k] / 32;
+        } else if (dither == DITHER_FS) {
+          rgb[k] += here[(x + 1) * 3 + k] / 16;
+          rgb[k] = (rgb[k] < 0) ? 0 : (rgb[k] > 255) ? 255 : rgb[k];
+        }
+      }
+      pixels[y * w + x] = Nearest (rgb, palette, count);
+      // spread error right and down
+      if (dither == DITHER_FS) {
+        Color888 (pixels[y * w + x], q);
+        for (k = 0; k < 3; k++) {
+          here[(x + 2) * 3 + k] += (rgb[k] - q[k]) * 7;
+          next[x * 3 + k] += (rgb[k] - q[k]) * 3;
+          next[(x + 1) * 3 + k] += (rgb[k] - q[k]) * 5;
+          next[(x + 2) * 3 + k] += (rgb[k] - q[k]);
+        }
+      }
+    }
+  }
+  free (error);
+}
+
+/**
+ * @desc    Encode raw565
+ *
+ * @param   struct bytes *
+ * @param   const unsigned * pixels
+ * @param   size_t n
+ *
+ * @return  void
+ */
+static void Raw565 (struct bytes * b, const unsigned * pixels, size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; i++) {
+    PutColor (b, pixels[i]);
+  }
+}
+
+/**
+ * @desc    Encode palette, fails over 256 colors
+ *
+ * @param   struct bytes *
+ * @param   const unsigned * pixels
+ * @param   unsigned w
+ * @param   unsigned h
+ *
+ * @return  int - bits per index, 0 = too many colors
+ */
+static int Palette (struct bytes * b, const unsigned * pixels, unsigned w, unsigned h)
+{
+  unsigned * index = Alloc (65536 * sizeof (unsigned));
+  unsigned palette[256];
+  unsigned count = 0;
+  unsigned bits;
+  unsigned x, y, used, byte;
+  size_t i;
+
+  // distinct colors
+  for (i = 0; i < (size_t) w * h; i++) {
+    if (index[pixels[i]] == 0) {
+      if (count == 256) {
+        free (index);
+        return 0;
+      }
+      palette[count++] = pixels[i];
+      index[pixels[i]] = count;
+    }
+  }
+  bits = (count <= 2) ? 1 : (count <= 4) ? 2 : (count <= 16) ? 4 : 8;
+  Put (b, bits);
+  Put (b, count & 0xFF);
+  for (i = 0; i < count; i++) {
+    PutColor (b, palette[i]);
+  }
+  // indices MSB first, rows padded
+  for (y = 0; y < h; y++) {
+    byte = used = 0;
+    for (x = 0; x < w; x++) {
+      byte = (byte << bits) | (index[pixels[y * w + x]] - 1);
+      used += bits;
+      if (used == 8) {
+        Put (b, byte);
+        byte = used = 0;
+      }
+    }
+    if (used) {
+      Put (b, byte << (8 - used));
+    }
+  }
+  free (index);
+  return bits;
+}
+
+/**
+ * @desc    Encode RLE
+ *
+ * @param   struct bytes *
+ * @param   const unsigned * pixels
+ * @param   size_t n
+ *
+ * @return  void
+ */
+static void RLE (struct bytes * b, const unsigned * pixels, size_t n)
+{
+  uint16_t * colors = Alloc (n * sizeof (uint16_t));
+  uint8_t * out = Alloc (ST7735_RLE_BOUND (n));
+  unsigned long length;
+  size_t i;
+
+  // encoder of library takes 565 colors
+  for (i = 0; i < n; i++) {
+    colors[i] = pixels[i];
+  }
+  length = ST7735_RLE_Encode (out, colors, n);
+  for (i = 0; i < length; i++) {
+    Put (b, out[i]);
+  }
+  free (out);
+  free (colors);
+}
+
+/**
+ * @desc    Convert PNG
+ *
+ * @param   int argc
+ * @param   char ** argv
+ *
+ * @return  int
+ */
+int main (int argc, char ** argv)
+{
+  static const char * names[3] = { "raw565", "palette", "rle" };
+  struct bytes code[3] = { { 0 } };
+  struct image img;
+  enum dither dither = DITHER_NONE;
+  unsigned long background = 0;
+  unsigned palette[256];
+  unsigned * pixels;
+  unsigned colors = 0, count = 0;
+  int format = -1, chosen, bits, opt;
+  const char * input;
+  char name[64];
+  const char * base;
+  size_t i, n;
+
+  // options
+  for (opt = 1; (opt + 1 < argc) && (argv[opt][0] == '-'); opt += 2) {
+    if (!strcmp (argv[opt], "-f")) {
+      for (format = 2; (format >= 0) && strncmp (argv[opt + 1], names[format], 3); format--);
+      if (format < 0) {
+        Fail ("format raw, palette or rle");
+      }
+    } else if (!strcmp (argv[opt], "-c")) {
+      colors = strtoul (argv[opt + 1], NULL, 0);
+      if ((colors < 2) || (colors > 256)) {
+        Fail ("colors 2 - 256");
+      }
+    } else if (!strcmp (argv[opt], "-d")) {
+      dither = !strcmp (argv[opt + 1], "ordered") ? DITHER_ORDERED : !strcmp (argv[opt + 1], "fs") ? DITHER_FS : DITHER_NONE;
+    } else if (!strcmp (argv[opt], "-b")) {
+      background = strtoul (argv[opt + 1], NULL, 16);
+    } else {
+      break;
+    }
+  }
+  if ((opt == argc) || (argc - opt > 2)) {
+    fprintf (stderr, "usage: %s [-f raw|palette|rle] [-c colors] [-d none|ordered|fs] [-b RRGGBB] input.png [NAME] > asset.c\n", argv[0]);
+    return 1;
+  }
+  input = argv[opt];
+  // name of array, file name by default
+  base = strrchr (input, '/') ? strrchr (input, '/') + 1 : input;
+  snprintf (name, sizeof (name), "%s", (argc - opt == 2) ? argv[opt + 1] : base);
+  if (argc - opt == 1) {
+    for (i = 0; name[i] && (name[i] != '.'); i++) {
+      name[i] = isalnum ((unsigned char) name[i]) ? toupper ((unsigned char) name[i]) : '_';
+    }
+    name[i] = '\0';
+  }
+  Load (input, background, &img);
+  n = (size_t) img.width * img.height;
+  pixels = Alloc (n * sizeof (unsigned));
+  // color reduction
+  if (colors) {
+    count = MedianCut (&img, colors, palette);
+    Reduce (&img, palette, count, dither, pixels);
+  } else {
+    Reduce (&img, NULL, 0, dither, pixels);
+  }
+  // all formats
+  for (i = 0; i < 3; i++) {
+    Put (&code[i], i);
+    Put (&code[i], img.width);
+    Put (&code[i], img.height);
+  }
+  Raw565 (&code[ST7735_ASSET_RAW565], pixels, n);
+  bits = Palette (&code[ST7735_ASSET_PALETTE], pixels, img.width, img.height);
+  RLE (&code[ST7735_ASSET_RLE], pixels, n);
+  // smallest one, raw565 decodes fastest on tie
+  chosen = ST7735_ASSET_RAW565;
+  for (i = 1; i < 3; i++) {
+    if ((bits || (i != ST7735_ASSET_PALETTE)) && (code[i].length < code[chosen].length)) {
+      chosen = i;
+    }
+  }
+  if (format >= 0) {
+    if ((format == ST7735_ASSET_PALETTE) && !bits) {
+      Fail ("more than 256 colors, use -c");
+    }
+    chosen = format;
+  }
+
+  // size report
+  fprintf (stderr, "%s: %u x %u, SPI %lu bytes in any format\n", name, img.width, img.height, (unsigned long) n * 2 + WINDOW_BYTES);
+  for (i = 0; i < 3; i++) {
+    if ((i == ST7735_ASSET_PALETTE) && !bits) {
+      fprintf (stderr, "  %-8s   more than 256 colors\n", names[i]);
+    } else {
+      fprintf (stderr, "  %-8s %6lu bytes flash%s%s\n", names[i], (unsigned long) code[i].length,
+        (i == ST7735_ASSET_PALETTE) ? ((bits == 1) ? ", 1bpp" : (bits == 2) ? ", 2bpp" : (bits == 4) ? ", 4bpp" : ", 8bpp") : "",
+        ((int) i == chosen) ? "  <-" : "");
+    }
+  }
+
+  printf ("// Generated by tools/st7735_asset from %s, do not edit\n\n", input);
+  printf ("#include \"lib/st7735_asset.h\"\n\n");
+  printf ("// %u x %u, %s, %lu bytes\n", img.width, img.height, names[chosen], (unsigned long) code[chosen].length);
+  printf ("const uint8_t %s[] PROGMEM = {\n", name);
+  for (i = 0; i < code[chosen].length; i++) {
+    printf ("%s0x%02X,%s", (i % 12) ? " " : "  ", code[chosen].data[i], ((i % 12 == 11) || (i + 1 == code[chosen].length)) ? "\n" : "");
+  }
+  printf ("};\n");
+  return 0;
+}
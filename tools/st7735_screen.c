@@ -0,0 +1,300 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST773 1.8" LCD Driver - screen compiler
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2026 agent.
+ *              Written by agent (agent@local)
+ *
+ * @author      agent
+ * @datum       18.10.2026
+ * @file        st7735_screen.c
+ * @version     2.0
+ * @tested      Linux
+ *
+ * @depend      lib/st7735_screen.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Compiles text description of static screen into PROGMEM array for
+ *              ST7735_Screen. Usage: st7735_screen input.screen NAME > screen.c
+ *
+ *              Words separated by white space, '#' starts comment till end of line:
+ *                color c | background c | clear
+ *                rect x0 x1 y0 y1 | line x1 x2 y1 y2 | window x0 x1 y0 y1
+ *                text x y X1|X2|X3 "string"
+ *                bitmap x y w h byte...      ((w + 7) / 8) * h bytes, MSB left
+ *                pixels n color...           n colors into last window
+ *              Numbers are decimal or 0x hex.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lib/st7735_screen.h"
+
+/** @struct Source being parsed */
+struct source {
+  // input
+  FILE * file;
+  // name and line for messages
+  const char * name;
+  unsigned line;
+  // last word
+  char word[256];
+};
+
+/** @struct Generated code */
+struct output {
+  // bytes of array
+  unsigned long bytes;
+  // items in current line
+  unsigned column;
+};
+
+/**
+ * @desc    Report error and quit
+ *
+ * @param   struct source *
+ * @param   const char * message
+ *
+ * @return  void
+ */
+static void Fail (const struct source * src, const char * message)
+{
+  fprintf (stderr, "%s:%u: %s\n", src->name, src->line, message);
+  exit (1);
+}
+
+/**
+ * @desc    Read next word, quoted string without quotes
+ *
+ * @param   struct source *
+ *
+ * @return  int - 0 = end of input
+ */
+static int Word (struct source * src)
+{
+  size_t length = 0;
+  int c;
+
+  // skip white space and comments
+  while ((c = fgetc (src->file)) != EOF) {
+    if (c == '\n') {
+      src->line++;
+    } else if (c == '#') {
+      while (((c = fgetc (src->file)) != EOF) && (c != '\n'));
+      src->line++;
+    } else if (!isspace (c)) {
+      break;
+    }
+  }
+  // end of input
+  if (c == EOF) {
+    return 0;
+  }
+  // quoted string
+  if (c == '"') {
+    while (((c = fgetc (src->file)) != EOF) && (c != '"') && (c != '\n')) {
+      // escaped quote or backslash
+      if (c == '\\') {
+        c = fgetc (src->file);
+      }
+      if (length + 1 >= sizeof (src->word)) {
+        Fail (src, "string too long");
+      }
+      src->word[length++] = c;
+    }
+    if (c != '"') {
+      Fail (src, "unterminated string");
+    }
+  // plain word
+  } else {
+    do {
+      if (length + 1 >= sizeof (src->word)) {
+        Fail (src, "word too long");
+      }
+      src->word[length++] = c;
+    } while (((c = fgetc (src->file)) != EOF) && !isspace (c));
+    if (c == '\n') {
+      ungetc (c, src->file);
+    }
+  }
+  src->word[length] = '\0';
+  return 1;
+}
+
+/**
+ * @desc    Read number within limit
+ *
+ * @param   struct source *
+ * @param   unsigned long max
+ *
+ * @return  unsigned long
+ */
+static unsigned long Number (struct source * src, unsigned long max)
+{
+  unsigned long value;
+  char * end;
+
+  if (!Word (src)) {
+    Fail (src, "number expected");
+  }
+  value = strtoul (src->word, &end, 0);
+  // not a number or out of range
+  if ((*end != '\0') || (src->word[0] == '-') || (value > max)) {
+    Fail (src, "number out of range");
+  }
+  return value;
+}
+
+/**
+ * @desc    Emit byte
+ *
+ * @param   struct output *
+ * @param   const char * text - C expression of byte
+ *
+ * @return  void
+ */
+static void Emit (struct output * out, const char * text)
+{
+  printf ("%s%s,", out->column ? " " : "  ", text);
+  out->bytes++;
+  // wrap long lines
+  if (++out->column == 12) {
+    printf ("\n");
+    out->column = 0;
+  }
+}
+
+/**
+ * @desc    Emit byte value
+ *
+ * @param   struct output *
+ * @param   unsigned value
+ *
+ * @return  void
+ */
+static void EmitByte (struct output * out, unsigned value)
+{
+  char text[8];
+
+  snprintf (text, sizeof (text), "0x%02X", value & 0xFF);
+  Emit (out, text);
+}
+
+/**
+ * @desc    Start operation on new line
+ *
+ * @param   struct output *
+ * @param   const char * op - name of operation
+ *
+ * @return  void
+ */
+static void EmitOp (struct output * out, const char * op)
+{
+  // operation begins line
+  if (out->column) {
+    printf ("\n");
+    out->column = 0;
+  }
+  Emit (out, op);
+}
+
+/**
+ * @desc    Compile description
+ *
+ * @param   int argc
+ * @param   char ** argv
+ *
+ * @return  int
+ */
+int main (int argc, char ** argv)
+{
+  struct source src = { .line = 1 };
+  struct output out = { 0 };
+  unsigned long count;
+  unsigned long value;
+  unsigned long i;
+  size_t length;
+  unsigned w, h;
+
+  if (argc != 3) {
+    fprintf (stderr, "usage: %s input.screen NAME > screen.c\n", argv[0]);
+    return 1;
+  }
+  src.name = argv[1];
+  src.file = fopen (argv[1], "r");
+  if (src.file == NULL) {
+    perror (argv[1]);
+    return 1;
+  }
+  printf ("// Generated by tools/st7735_screen from %s, do not edit\n\n", argv[1]);
+  printf ("#include \"lib/st7735_screen.h\"\n\n");
+  printf ("const uint8_t %s[] PROGMEM = {\n", argv[2]);
+
+  // loop through operations
+  while (Word (&src)) {
+    // colors
+    if (!strcmp (src.word, "color") || !strcmp (src.word, "background")) {
+      EmitOp (&out, (src.word[0] == 'c') ? "ST7735_SCREEN_COLOR" : "ST7735_SCREEN_BACKGROUND");
+      value = Number (&src, 0xFFFF);
+      EmitByte (&out, value >> 8);
+      EmitByte (&out, value);
+    // whole screen
+    } else if (!strcmp (src.word, "clear")) {
+      EmitOp (&out, "ST7735_SCREEN_CLEAR");
+    // 4 coordinates
+    } else if (!strcmp (src.word, "rect") || !strcmp (src.word, "line") || !strcmp (src.word, "window")) {
+      EmitOp (&out, (src.word[0] == 'r') ? "ST7735_SCREEN_RECT" : (src.word[0] == 'l') ? "ST7735_SCREEN_LINE" : "ST7735_SCREEN_WINDOW");
+      for (i = 0; i < 4; i++) {
+        EmitByte (&out, Number (&src, 0xFF));
+      }
+    // text
+    } else if (!strcmp (src.word, "text")) {
+      EmitOp (&out, "ST7735_SCREEN_TEXT");
+      EmitByte (&out, Number (&src, 0xFF));
+      EmitByte (&out, Number (&src, 0xFF));
+      if (!Word (&src) || (strcmp (src.word, "X1") && strcmp (src.word, "X2") && strcmp (src.word, "X3"))) {
+        Fail (&src, "size X1, X2 or X3 expected");
+      }
+      Emit (&out, src.word);
+      if (!Word (&src)) {
+        Fail (&src, "string expected");
+      }
+      length = strlen (src.word);
+      EmitByte (&out, length);
+      for (i = 0; i < length; i++) {
+        EmitByte (&out, (unsigned char) src.word[i]);
+      }
+    // 1 bit per pixel
+    } else if (!strcmp (src.word, "bitmap")) {
+      EmitOp (&out, "ST7735_SCREEN_BITMAP");
+      EmitByte (&out, Number (&src, 0xFF));
+      EmitByte (&out, Number (&src, 0xFF));
+      EmitByte (&out, w = Number (&src, 0xFF));
+      EmitByte (&out, h = Number (&src, 0xFF));
+      for (i = 0; i < (unsigned long) ((w + 7) >> 3) * h; i++) {
+        EmitByte (&out, Number (&src, 0xFF));
+      }
+    // colors into window
+    } else if (!strcmp (src.word, "pixels")) {
+      EmitOp (&out, "ST7735_SCREEN_PIXELS");
+      count = Number (&src, 0xFFFF);
+      EmitByte (&out, count >> 8);
+      EmitByte (&out, count);
+      for (i = 0; i < count; i++) {
+        value = Number (&src, 0xFFFF);
+        EmitByte (&out, value >> 8);
+        EmitByte (&out, value);
+      }
+    } else {
+      Fail (&src, "unknown operation");
+    }
+  }
+  EmitOp (&out, "ST7735_SCREEN_END");
+  printf ("\n};\n");
+  fclose (src.file);
+  // size report
+  fprintf (stderr, "%s: %lu bytes\n", argv[2], out.bytes);
+  return 0;
+}